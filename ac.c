@@ -0,0 +1,378 @@
+#include "ac.h"
+#include "arena.h"
+#include "node.h"
+#include "parser.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// The automaton works on a compressed alphabet: every byte is mapped to one
+// of AC_ALPHA symbols. ASCII letters (folded to lower case), digits, ' and -
+// are word characters; every other byte, including the bytes of multibyte
+// UTF-8 characters that next_word would keep, is a separator, and a run of
+// separators is fed to the automaton as a single AC_SEP.
+//
+// The transition table is dense, not a double-array or otherwise compressed
+// one: every state has a full row of AC_ALPHA uint32_t, so a byte costs one
+// indexed load and no failure links are followed while scanning. The price is
+// memory: 156 bytes of row plus 12 of fail, out and hit links per state, and
+// a trie of patterns has up to one state per pattern byte (two more per
+// pattern with boundaries). A dictionary of 100,000 eight letter words can take
+// up to about 170 MB; ac_table_bytes returns the size and -s prints it.
+#define AC_ALPHA 39
+#define AC_SEP 0
+#define AC_NONE UINT32_MAX
+#define AC_CHUNK 65536
+
+// A pattern: its oldspeak (zero padded to NODE_INLINE bytes), length and
+// newspeak (NULL if it is badspeak)
+typedef struct Pattern Pattern;
+
+struct Pattern {
+  char *oldspeak;
+  uint32_t len;
+  char *newspeak;
+};
+
+// Defines what members/fields the Automaton has.
+// symbol maps a byte to its symbol and text maps a symbol back to a character.
+// delta is the transition table, one row of AC_ALPHA states per state. After
+// ac_build it is a complete DFA (failure transitions are folded in). fail is
+// the failure link of a state, out the pattern that ends at a state, and hit
+// the first state on the failure chain (starting with the state itself) that
+// has a pattern, so the scan loop only branches when there is a match.
+// boundaries makes patterns only match whole words. state and sep are the
+// position of the scan, kept between calls to ac_scan.
+typedef struct Automaton Automaton;
+
+struct Automaton {
+  uint8_t symbol[256];
+  char text[AC_ALPHA];
+  uint32_t *delta;
+  uint32_t *fail;
+  uint32_t *out;
+  uint32_t *hit;
+  uint32_t n_states;
+  uint32_t cap;
+  Pattern *patterns;
+  uint32_t n_patterns;
+  uint32_t p_cap;
+  Arena *arena;
+  bool boundaries;
+  uint32_t state;
+  bool sep;
+  uint64_t n_bytes;
+  uint64_t n_matches;
+};
+
+// Adds a state with no transitions to the automaton and returns it, or
+// AC_NONE if the memory couldn't be allocated
+static uint32_t new_state(Automaton *ac) {
+  if (ac->n_states == ac->cap) {
+    uint32_t cap = ac->cap * 2;
+    uint32_t *delta =
+        (uint32_t *)realloc(ac->delta, sizeof(uint32_t) * cap * AC_ALPHA);
+    if (delta == NULL) {
+      return AC_NONE;
+    }
+    ac->delta = delta;
+    uint32_t *out = (uint32_t *)realloc(ac->out, sizeof(uint32_t) * cap);
+    if (out == NULL) {
+      return AC_NONE;
+    }
+    ac->out = out;
+    ac->cap = cap;
+  }
+  uint32_t s = ac->n_states;
+  for (uint32_t i = 0; i < AC_ALPHA; i += 1) {
+    ac->delta[s * AC_ALPHA + i] = AC_NONE;
+  }
+  ac->out[s] = AC_NONE;
+  ac->n_states += 1;
+  return s;
+}
+
+// The constructor for the Automaton. Creates an empty automaton (just the
+// root state). If boundaries is true, patterns only match whole words.
+Automaton *ac_create(bool boundaries) {
+  Automaton *ac = (Automaton *)calloc(1, sizeof(Automaton));
+  if (ac) {
+    ac->boundaries = boundaries;
+    ac->cap = 256;
+    ac->delta = (uint32_t *)malloc(sizeof(uint32_t) * ac->cap * AC_ALPHA);
+    ac->out = (uint32_t *)malloc(sizeof(uint32_t) * ac->cap);
+    ac->arena = arena_create(AC_CHUNK);
+    if (ac->delta == NULL || ac->out == NULL || ac->arena == NULL) {
+      ac_delete(&ac);
+      return NULL;
+    }
+    // Builds the byte to symbol map
+    ac->text[AC_SEP] = ' ';
+    for (uint32_t c = 'a'; c <= 'z'; c += 1) {
+      ac->symbol[c] = ac->symbol[c - 'a' + 'A'] = 1 + c - 'a';
+      ac->text[1 + c - 'a'] = c;
+    }
+    for (uint32_t c = '0'; c <= '9'; c += 1) {
+      ac->symbol[c] = 27 + c - '0';
+      ac->text[27 + c - '0'] = c;
+    }
+    ac->symbol['\''] = 37;
+    ac->text[37] = '\'';
+    ac->symbol['-'] = 38;
+    ac->text[38] = '-';
+    new_state(ac); // The root
+  }
+  return ac;
+}
+
+// The destructor for the Automaton. Frees the tables, the patterns and the
+// Automaton, and sets it to NULL.
+void ac_delete(Automaton **ac) {
+  if (*ac) {
+    free((*ac)->delta);
+    free((*ac)->fail);
+    free((*ac)->out);
+    free((*ac)->hit);
+    free((*ac)->patterns);
+    arena_delete(&(*ac)->arena);
+    free(*ac);
+    *ac = NULL;
+  }
+}
+
+// Normalizes s the way the automaton sees text: lower case, separators
+// collapsed to a single space and trimmed. Writes the symbols to sym and
+// returns how many there are.
+static uint32_t normalize(Automaton *ac, char *s, uint8_t *sym) {
+  uint32_t n = 0;
+  for (uint32_t i = 0; s[i] != '\0' && n < MAX_PARSER_LINE_LENGTH; i += 1) {
+    uint8_t x = ac->symbol[(uint8_t)s[i]];
+    if (x != AC_SEP || (n > 0 && sym[n - 1] != AC_SEP)) {
+      sym[n] = x;
+      n += 1;
+    }
+  }
+  while (n > 0 && sym[n - 1] == AC_SEP) {
+    n -= 1;
+  }
+  return n;
+}
+
+// Adds the pattern (a word or a phrase) to the automaton, with its newspeak
+// (NULL for badspeak). If the pattern is already in the automaton the first
+// one is kept, like ht_insert does. Returns false on allocation failure.
+// Must be called before ac_build.
+bool ac_add(Automaton *ac, char *pattern, char *newspeak) {
+  uint8_t sym[MAX_PARSER_LINE_LENGTH + 1];
+  uint32_t n = normalize(ac, pattern, sym);
+  if (n == 0) {
+    return true;
+  }
+  // Walk the trie, creating the states that are missing. With word boundaries
+  // the pattern is surrounded by separators.
+  uint32_t s = 0;
+  for (int64_t i = ac->boundaries ? -1 : 0; i <= (int64_t)n; i += 1) {
+    uint8_t x = AC_SEP;
+    if (i >= 0 && i < n) {
+      x = sym[i];
+    } else if (!ac->boundaries) {
+      continue;
+    }
+    uint32_t next = ac->delta[s * AC_ALPHA + x];
+    if (next == AC_NONE) {
+      next = new_state(ac);
+      if (next == AC_NONE) {
+        return false;
+      }
+      ac->delta[s * AC_ALPHA + x] = next;
+    }
+    s = next;
+  }
+  if (ac->out[s] != AC_NONE) {
+    return true;
+  }
+  // Remember the pattern's text
+  if (ac->n_patterns == ac->p_cap) {
+    uint32_t cap = ac->p_cap ? ac->p_cap * 2 : 64;
+    Pattern *p = (Pattern *)realloc(ac->patterns, sizeof(Pattern) * cap);
+    if (p == NULL) {
+      return false;
+    }
+    ac->patterns = p;
+    ac->p_cap = cap;
+  }
+  Pattern *p = &ac->patterns[ac->n_patterns];
+  uint32_t size = n + 1 < NODE_INLINE ? NODE_INLINE : n + 1;
+  p->oldspeak = (char *)arena_alloc(ac->arena, size);
+  if (p->oldspeak == NULL) {
+    return false;
+  }
+  memset(p->oldspeak, 0, size);
+  for (uint32_t i = 0; i < n; i += 1) {
+    p->oldspeak[i] = ac->text[sym[i]];
+  }
+  p->len = n;
+  p->newspeak = NULL;
+  if (newspeak) {
+    p->newspeak = arena_strdup(ac->arena, newspeak, strlen(newspeak));
+  }
+  ac->out[s] = ac->n_patterns;
+  ac->n_patterns += 1;
+  return true;
+}
+
+// Reads in the badspeak file (one word or phrase per line) and the newspeak
+// file (the last word of a line is the newspeak for the word or phrase before
+// it) and adds them to the automaton. Returns false if a file can't be opened.
+bool ac_load(Automaton *ac, char *badspeak, char *newspeak) {
+  char line[MAX_PARSER_LINE_LENGTH + 1];
+  FILE *f = fopen(badspeak, "r");
+  if (f == NULL) {
+    return false;
+  }
+  while (fgets(line, MAX_PARSER_LINE_LENGTH, f) != NULL) {
+    ac_add(ac, line, NULL);
+  }
+  fclose(f);
+
+  FILE *new = fopen(newspeak, "r");
+  if (new == NULL) {
+    return false;
+  }
+  while (fgets(line, MAX_PARSER_LINE_LENGTH, new) != NULL) {
+    uint8_t sym[MAX_PARSER_LINE_LENGTH + 1];
+    uint32_t n = normalize(ac, line, sym);
+    // Split the line at its last separator
+    int64_t last = (int64_t)n - 1;
+    while (last >= 0 && sym[last] != AC_SEP) {
+      last -= 1;
+    }
+    if (last <= 0) {
+      continue; // No newspeak on this line
+    }
+    for (uint32_t i = 0; i < n; i += 1) {
+      line[i] = ac->text[sym[i]];
+    }
+    line[last] = line[n] = '\0';
+    ac_add(ac, line, line + last + 1);
+  }
+  fclose(new);
+  return true;
+}
+
+// Computes the failure links and turns the trie into a complete DFA, so that
+// scanning takes exactly one table lookup per symbol. Returns false if the
+// memory couldn't be allocated.
+bool ac_build(Automaton *ac) {
+  uint32_t n = ac->n_states;
+  ac->fail = (uint32_t *)malloc(sizeof(uint32_t) * n);
+  ac->hit = (uint32_t *)malloc(sizeof(uint32_t) * n);
+  uint32_t *queue = (uint32_t *)malloc(sizeof(uint32_t) * n);
+  if (ac->fail == NULL || ac->hit == NULL || queue == NULL) {
+    free(queue);
+    return false;
+  }
+  uint32_t head = 0;
+  uint32_t tail = 0;
+  ac->fail[0] = 0;
+  ac->hit[0] = AC_NONE;
+  // The children of the root fail back to the root
+  for (uint32_t x = 0; x < AC_ALPHA; x += 1) {
+    uint32_t u = ac->delta[x];
+    if (u == AC_NONE) {
+      ac->delta[x] = 0;
+    } else {
+      ac->fail[u] = 0;
+      ac->hit[u] = ac->out[u] != AC_NONE ? u : AC_NONE;
+      queue[tail++] = u;
+    }
+  }
+  // Breadth first, so the failure target of a state is always finished
+  while (head < tail) {
+    uint32_t r = queue[head++];
+    uint32_t *row = &ac->delta[r * AC_ALPHA];
+    uint32_t *frow = &ac->delta[ac->fail[r] * AC_ALPHA];
+    for (uint32_t x = 0; x < AC_ALPHA; x += 1) {
+      uint32_t u = row[x];
+      if (u == AC_NONE) {
+        row[x] = frow[x];
+      } else {
+        uint32_t f = frow[x];
+        ac->fail[u] = f;
+        ac->hit[u] = ac->out[u] != AC_NONE ? u : ac->hit[f];
+        queue[tail++] = u;
+      }
+    }
+  }
+  free(queue);
+  // Start the scan as if the text began with a separator
+  ac->state = ac->boundaries ? ac->delta[AC_SEP] : 0;
+  ac->sep = true;
+  return true;
+}
+
+// Calls fn for every pattern that ends at state s
+static void report(Automaton *ac, uint32_t s, ac_match_fn fn, void *arg) {
+  for (s = ac->hit[s]; s != AC_NONE; s = ac->hit[ac->fail[s]]) {
+    Pattern *p = &ac->patterns[ac->out[s]];
+    fn(p->oldspeak, p->len, p->newspeak, arg);
+    ac->n_matches += 1;
+  }
+}
+
+// Scans n bytes of raw text in one pass and calls fn for every match. The
+// text may be fed in any number of pieces; matches spanning pieces are found.
+void ac_scan(Automaton *ac, char *buf, size_t n, ac_match_fn fn, void *arg) {
+  uint32_t s = ac->state;
+  bool sep = ac->sep;
+  for (size_t i = 0; i < n; i += 1) {
+    uint8_t x = ac->symbol[(uint8_t)buf[i]];
+    if (x == AC_SEP) {
+      if (sep) {
+        continue; // A run of separators is a single symbol
+      }
+      sep = true;
+    } else {
+      sep = false;
+    }
+    s = ac->delta[s * AC_ALPHA + x];
+    if (ac->hit[s] != AC_NONE) {
+      report(ac, s, fn, arg);
+    }
+  }
+  ac->state = s;
+  ac->sep = sep;
+  ac->n_bytes += n;
+}
+
+// Ends the text: reports the matches that need a separator after them and
+// resets the automaton for the next text.
+void ac_finish(Automaton *ac, ac_match_fn fn, void *arg) {
+  if (!ac->sep) {
+    uint32_t s = ac->delta[ac->state * AC_ALPHA + AC_SEP];
+    if (ac->hit[s] != AC_NONE) {
+      report(ac, s, fn, arg);
+    }
+  }
+  ac->state = ac->boundaries ? ac->delta[AC_SEP] : 0;
+  ac->sep = true;
+}
+
+// Returns the number of states of the automaton
+uint32_t ac_states(Automaton *ac) { return ac->n_states; }
+
+// Returns the number of bytes the transition table and the state links take
+uint64_t ac_table_bytes(Automaton *ac) {
+  return (uint64_t)ac->n_states * sizeof(uint32_t) * (AC_ALPHA + 3);
+}
+
+// Returns the number of patterns in the automaton
+uint32_t ac_patterns(Automaton *ac) { return ac->n_patterns; }
+
+// Sets the stats (bytes scanned and matches reported)
+void ac_stats(Automaton *ac, uint64_t *bytes, uint64_t *matches) {
+  *bytes = ac->n_bytes;
+  *matches = ac->n_matches;
+}
@@ -0,0 +1,37 @@
+#ifndef __AC_H__
+#define __AC_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct Automaton Automaton;
+
+// Called for every match with the matched oldspeak (zero padded to
+// NODE_INLINE bytes), its length and its newspeak (NULL for badspeak).
+typedef void (*ac_match_fn)(char *oldspeak, uint32_t len, char *newspeak,
+                            void *arg);
+
+Automaton *ac_create(bool boundaries);
+
+void ac_delete(Automaton **ac);
+
+bool ac_add(Automaton *ac, char *pattern, char *newspeak);
+
+bool ac_load(Automaton *ac, char *badspeak, char *newspeak);
+
+bool ac_build(Automaton *ac);
+
+void ac_scan(Automaton *ac, char *buf, size_t n, ac_match_fn fn, void *arg);
+
+void ac_finish(Automaton *ac, ac_match_fn fn, void *arg);
+
+uint32_t ac_states(Automaton *ac);
+
+uint64_t ac_table_bytes(Automaton *ac);
+
+uint32_t ac_patterns(Automaton *ac);
+
+void ac_stats(Automaton *ac, uint64_t *bytes, uint64_t *matches);
+
+#endif
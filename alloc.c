@@ -0,0 +1,62 @@
+#include "alloc.h"
+
+#include <stdatomic.h>
+#include <stddef.h>
+
+static _Atomic uint64_t count; // Number of heap allocations so far
+
+// Returns the number of heap allocations made so far (always 0 unless the
+// program was built with ALLOC_CHECK)
+uint64_t alloc_count(void) { return count; }
+
+#ifdef ALLOC_CHECK
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+// The allocator of the C library, which the functions below wrap
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t n, size_t size);
+extern void *__libc_realloc(void *p, size_t size);
+extern void *__libc_memalign(size_t alignment, size_t size);
+
+static _Thread_local bool guarded; // Set while this thread may not allocate
+
+// Turns the guard of the calling thread on or off. The scan loops turn it on
+// once they are warmed up, so any allocation in them is caught.
+void alloc_guard(bool on) { guarded = on; }
+
+// Counts an allocation, and aborts if the thread is guarded. Only write() is
+// used to report it, since printf could allocate.
+static void check(const char *fn) {
+  count += 1;
+  if (guarded) {
+    guarded = false;
+    const char *msg = "./banhammer: heap allocation in the scan loop: ";
+    write(STDERR_FILENO, msg, strlen(msg));
+    write(STDERR_FILENO, fn, strlen(fn));
+    write(STDERR_FILENO, "\n", 1);
+    abort();
+  }
+}
+
+void *malloc(size_t size) {
+  check("malloc");
+  return __libc_malloc(size);
+}
+
+void *calloc(size_t n, size_t size) {
+  check("calloc");
+  return __libc_calloc(n, size);
+}
+
+void *realloc(void *p, size_t size) {
+  check("realloc");
+  return __libc_realloc(p, size);
+}
+
+void *aligned_alloc(size_t alignment, size_t size) {
+  check("aligned_alloc");
+  return __libc_memalign(alignment, size);
+}
+#endif
@@ -0,0 +1,18 @@
+#ifndef __ALLOC_H__
+#define __ALLOC_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Built with -DALLOC_CHECK (make CPPFLAGS=-DALLOC_CHECK), every heap
+// allocation is counted, and one made by a thread while its guard is on
+// aborts the program. Otherwise the guard compiles to nothing.
+#ifdef ALLOC_CHECK
+void alloc_guard(bool on);
+#else
+static inline void alloc_guard(bool on) { (void)on; }
+#endif
+
+uint64_t alloc_count(void);
+
+#endif
@@ -0,0 +1,150 @@
+#include "arena.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Defines what members/fields the Arena structure has.
+// An Arena hands out memory from large chunks and frees everything at once
+// when it is deleted. chunks is a linked list of the chunks (newest first),
+// used is how much of the newest chunk is handed out, and chunk_size is the
+// size of a new chunk. bytes tracks the total memory handed out.
+typedef struct Chunk Chunk;
+
+struct Chunk {
+  Chunk *next;
+  uint32_t size;
+  _Alignas(16) char data[];
+};
+
+typedef struct Arena Arena;
+
+struct Arena {
+  Chunk *chunks;
+  uint32_t used;
+  uint32_t chunk_size;
+  uint64_t bytes;
+};
+
+// The constructor for the Arena. Creates a new, empty Arena whose chunks will
+// be chunk_size bytes. Returns NULL if the memory couldn't be allocated.
+Arena *arena_create(uint32_t chunk_size) {
+  Arena *a = (Arena *)malloc(sizeof(Arena));
+  if (a) {
+    a->chunks = NULL;
+    a->used = 0;
+    a->chunk_size = chunk_size;
+    a->bytes = 0;
+  }
+  return a;
+}
+
+// The destructor for an Arena. Frees every chunk (and so everything that was
+// allocated from the Arena), frees the Arena and sets it to NULL.
+void arena_delete(Arena **a) {
+  if (*a) {
+    Chunk *c = (*a)->chunks;
+    while (c != NULL) {
+      Chunk *next = c->next;
+      free(c);
+      c = next;
+    }
+    free(*a);
+    *a = NULL;
+  }
+}
+
+// Makes sure the next size bytes can be allocated from the Arena without
+// allocating memory, by starting a chunk that big now if the current one
+// doesn't have room. Returns false if the memory couldn't be allocated.
+bool arena_reserve(Arena *a, uint32_t size) {
+  if (a->chunks != NULL && a->used + size <= a->chunks->size) {
+    return true;
+  }
+  uint32_t s = size > a->chunk_size ? size : a->chunk_size;
+  Chunk *c = (Chunk *)malloc(sizeof(Chunk) + s);
+  if (c == NULL) {
+    return false;
+  }
+  c->size = s;
+  c->next = a->chunks;
+  a->chunks = c;
+  a->used = 0;
+  return true;
+}
+
+// Allocates size bytes (16-byte aligned) from the Arena. A new chunk is started
+// when the current one is full; allocations larger than a chunk get a chunk of
+// their own. Returns NULL if the memory couldn't be allocated.
+void *arena_alloc(Arena *a, uint32_t size) {
+  size = (size + 15) & ~15u; // Keeps the next allocation aligned
+  if (!arena_reserve(a, size)) {
+    return NULL;
+  }
+  void *p = a->chunks->data + a->used;
+  a->used += size;
+  a->bytes += size;
+  return p;
+}
+
+// Frees everything that was allocated from the Arena, but keeps its biggest
+// chunk so that it can be used again without allocating memory.
+void arena_reset(Arena *a) {
+  Chunk *biggest = a->chunks;
+  for (Chunk *c = a->chunks; c != NULL; c = c->next) {
+    if (c->size > biggest->size) {
+      biggest = c;
+    }
+  }
+  Chunk *c = a->chunks;
+  while (c != NULL) {
+    Chunk *next = c->next;
+    if (c != biggest) {
+      free(c);
+    }
+    c = next;
+  }
+  if (biggest) {
+    biggest->next = NULL;
+  }
+  a->chunks = biggest;
+  a->used = 0;
+  a->bytes = 0;
+}
+
+// Moves every chunk of src into dst, so that what was allocated from src is
+// freed with dst. dst keeps allocating from its current chunk, and src is
+// left empty.
+void arena_absorb(Arena *dst, Arena *src) {
+  if (src->chunks == NULL) {
+    return;
+  }
+  Chunk *last = src->chunks;
+  while (last->next != NULL) {
+    last = last->next;
+  }
+  if (dst->chunks == NULL) {
+    dst->chunks = src->chunks;
+    dst->used = src->used;
+  } else {
+    last->next = dst->chunks->next;
+    dst->chunks->next = src->chunks;
+  }
+  dst->bytes += src->bytes;
+  src->chunks = NULL;
+  src->used = 0;
+  src->bytes = 0;
+}
+
+// Copies the string s of length len into the Arena and returns the copy
+char *arena_strdup(Arena *a, char *s, uint32_t len) {
+  char *dup = (char *)arena_alloc(a, len + 1);
+  if (dup) {
+    memcpy(dup, s, len);
+    dup[len] = '\0';
+  }
+  return dup;
+}
+
+// Returns the number of bytes handed out by the Arena
+uint64_t arena_bytes(Arena *a) { return a->bytes; }
@@ -0,0 +1,25 @@
+#ifndef __ARENA_H__
+#define __ARENA_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+typedef struct Arena Arena;
+
+Arena *arena_create(uint32_t chunk_size);
+
+void arena_delete(Arena **a);
+
+void *arena_alloc(Arena *a, uint32_t size);
+
+bool arena_reserve(Arena *a, uint32_t size);
+
+void arena_reset(Arena *a);
+
+void arena_absorb(Arena *dst, Arena *src);
+
+char *arena_strdup(Arena *a, char *s, uint32_t len);
+
+uint64_t arena_bytes(Arena *a);
+
+#endif
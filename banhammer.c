@@ -1,19 +1,64 @@
+#include "batch.h"
+#include "bench.h"
 #include "bf.h"
+#include "ac.h"
+#include "alloc.h"
 #include "bv.h"
+#include "cpu.h"
+#include "decomp.h"
+#include "dh.h"
+#include "dict.h"
+#include "hash.h"
 #include "ht.h"
+#include "input.h"
 #include "ll.h"
 #include "messages.h"
 #include "node.h"
+#include "norm.h"
 #include "parser.h"
+#include "pending.h"
+#include "prof.h"
+#include "rc.h"
+#include "reload.h"
+#include "shm.h"
+#include "scan.h"
+#include "seed.h"
+#include "tc.h"
+#include "trie.h"
 #include <ctype.h>
+#include <getopt.h>
 #include <math.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include <unistd.h>
 
 #define MAX_PARSER_LINE_LENGTH 1000
+#define SCAN_BUFFER 65536
+#define SEED_OPTION 256
+#define CPU_OPTION 257
+#define HASH_OPTION 258
+#define BENCH_HASH_OPTION 259
+#define CACHE_OPTION 260
+#define BATCH_OPTION 261
+#define RESULT_CACHE_OPTION 262
+#define PROFILE_OPTION 263
+#define TRIE_OPTION 264
+#define BUILD_TRIE_OPTION 265
+#define EMIT_STATIC_OPTION 266
+#define SHM_OPTION 267
+#define SHM_PUBLISH_OPTION 268
+#define SHM_REMOVE_OPTION 269
+#define FAST_START_OPTION 270
+#define LOAD_THREADS_OPTION 271
+#define BUILD_DISK_OPTION 272
+#define DISK_OPTION 273
+#define BENCH_DISK_OPTION 274
+#define INPUT_OPTION 275
+#define NORMALIZE_OPTION 276
+#define BENCH_NORMALIZE_OPTION 277
 
 // My implementation of the strlen function from the string library.
 // Takes a string argument and returns its size.
@@ -57,6 +102,20 @@ bool mystrcmps(char *s, char *s1) {
 }
 // int test(void);
 
+#ifdef STATIC_DICT
+// The dictionary compiled into banhammer-static (dict_static.c, generated by
+// --emit-static)
+extern const unsigned char static_dict[];
+extern const uint64_t static_dict_size;
+#endif
+
+// Returns the time of the monotonic clock in ns
+uint64_t now_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
 // Function to print the help usage message
 void print_error(void) {
   fprintf(stderr, "Usage: ./banhammer [options]\n");
@@ -76,29 +135,355 @@ void print_error(void) {
       "    -f <bf_size>: Bloom filter size set to <bf_size>. (default 2^19)\n");
   fprintf(stderr, "    -s          : Enables the printing of statistics.\n");
   fprintf(stderr, "    -m          : Enables move-to-front rule.\n");
+  fprintf(stderr, "    -c          : Use a counting Bloom filter (words can "
+                  "be removed,\n"
+                  "                  so -r applies changes in place).\n");
+  fprintf(stderr, "    -r          : Reload %s and %s when they change or on "
+                  "SIGHUP.\n",
+          BADSPEAK_FILE, NEWSPEAK_FILE);
+  fprintf(stderr, "    -j <n>      : Look words up with <n> threads (default: "
+                  "1).\n");
+  fprintf(stderr, "    -a          : Match with the Aho-Corasick engine, which "
+                  "also finds phrases.\n");
+  fprintf(stderr, "    -A          : Like -a, but words and phrases also match "
+                  "inside longer words.\n");
+  fprintf(stderr, "    --seed <n>  : Seed the salts with <n> (default: random "
+                  "per process).\n");
+  fprintf(stderr, "    --cpu <isa> : Use kernels no newer than <isa> (scalar, "
+                  "sse4.2, avx2, avx512).\n");
+  fprintf(stderr, "    --hash <h>  : Hash words with <h> (auto, city, wyhash, "
+                  "crc32c; default auto:\n"
+                  "                  crc32c with sse4.2, else city).\n");
+  fprintf(stderr, "    --cache <n> : Remember the verdicts of <n> recent words "
+                  "(default: %u, 0 = off).\n",
+          TC_DEFAULT_ENTRIES);
+  fprintf(stderr, "    --batch <p> : Print a verdict for each file of directory "
+                  "<p>, or of the\n"
+                  "                  list of paths in file <p> (- for "
+                  "stdin).\n");
+  fprintf(stderr, "    --result-cache <mb>: With --batch, remember the "
+                  "verdicts of documents in\n"
+                  "                  up to <mb> MiB (default: %u, 0 = off).\n",
+          RC_DEFAULT_MB);
+  fprintf(stderr, "    --profile <fmt>: Time each stage of the scan and print "
+                  "it to stderr as text\n"
+                  "                  or json at exit and on SIGUSR1, even "
+                  "while waiting for input\n"
+                  "                  (needs a PROFILE build; not with -j, "
+                  "--batch, -a or -A).\n");
+  fprintf(stderr, "    --build-trie <f>: Compile %s and %s into the "
+                  "trie file <f>.\n",
+          BADSPEAK_FILE, NEWSPEAK_FILE);
+  fprintf(stderr, "    --emit-static <f>: Compile them into C source <f> "
+                  "for banhammer-static.\n");
+  fprintf(stderr, "    --trie <f>  : Look words up in the trie file <f> "
+                  "(mmap'd) instead of the Bloom\n"
+                  "                  filter and hash table.\n");
+  fprintf(stderr, "    --shm-publish <name>: Compile %s and %s into a "
+                  "trie and publish it\n"
+                  "                  as the next generation of the shared "
+                  "dictionary <name>.\n",
+          BADSPEAK_FILE, NEWSPEAK_FILE);
+  fprintf(stderr, "    --shm <name>: Look words up in the shared dictionary "
+                  "<name>, mapped once\n"
+                  "                  for all the processes (-r follows new "
+                  "generations).\n");
+  fprintf(stderr, "    --shm-remove <name>: Remove the shared dictionary "
+                  "<name>.\n");
+  fprintf(stderr, "    --fast-start: Start scanning once the Bloom filter "
+                  "is built, while the hash\n"
+                  "                  table is built in the background.\n");
+  fprintf(stderr, "    --load-threads <n>: Build the Bloom filter and hash "
+                  "table with <n> threads\n"
+                  "                  (default: 1).\n");
+  fprintf(stderr, "    --build-disk <f>: Compile %s and %s into the "
+                  "hash file <f>.\n",
+          BADSPEAK_FILE, NEWSPEAK_FILE);
+  fprintf(stderr, "    --disk <f>  : Look words up in the hash file <f>, "
+                  "which stays on disk\n"
+                  "                  (for dictionaries too big for memory).\n");
+  fprintf(stderr, "    --bench-disk <f>: Benchmark the lookups in the hash "
+                  "file <f> instead of\n"
+                  "                  scanning.\n");
+  fprintf(stderr, "    --input <e> : Read stdin with stdio (default), read, "
+                  "uring (io_uring, reading\n"
+                  "                  ahead while scanning) or auto (uring "
+                  "if the kernel has it).\n"
+                  "                  gzip and zstd input is decompressed "
+                  "with any of them.\n");
+  fprintf(stderr, "    --normalize <k>: Normalize words while tokenizing: "
+                  "none (default), all, or\n"
+                  "                  a list of leet, diacritics, confusables "
+                  "and ignorables, such as\n"
+                  "                  leet,diacritics. Trie, hash and shared "
+                  "files must be built with\n"
+                  "                  the same <k>.\n");
+  fprintf(stderr, "    --bench-normalize: Benchmark the tokenizer with each "
+                  "normalization on the\n"
+                  "                  text of stdin instead of scanning.\n");
+  fprintf(stderr, "    --bench-hash: Benchmark the hashes on the dictionary "
+                  "instead of scanning.\n");
   fprintf(stderr, "    -h          : Display program synopsis and usage.\n");
 }
 
+// Prints the right message based on the crimes, followed by the words that
+// caused it
+void print_punishment(LinkedList *thought_crime, LinkedList *rightspeak) {
+  if ((ll_length(thought_crime) > 0) && (ll_length(rightspeak) > 0)) {
+    printf("%s", mixspeak_message);
+    ll_print(thought_crime);
+    ll_print(rightspeak);
+  } else if (ll_length(thought_crime) > 0) {
+    printf("%s", badspeak_message);
+    ll_print(thought_crime);
+  } else if (ll_length(rightspeak) > 0) {
+    printf("%s", goodspeak_message);
+    ll_print(rightspeak);
+  }
+}
+
+// Adds word to the right offense list, based on its Node n in the dictionary.
+// The offense lists reuse the length of the node, but with a fingerprint of
+// their own (offense_fp), since that of the node depends on the salt.
+void record_offense(Offenses *o, char *word, Node *n) {
+  if (n->newspeak == NULL) { // If it's only oldspeak, then thought crime
+    ll_insert(o->thought_crime, word, NULL, n->len, offense_fp(word, n->len));
+  } else { // If both, then rightspeak crime
+    ll_insert(o->rightspeak, word, n->newspeak, n->len,
+              offense_fp(word, n->len));
+  }
+}
+
+// Looks up the words whose Bloom filter hits were put off while the hash table
+// was being built, in the order they were read, so the offense lists come out
+// as if they had been looked up right away. Their verdicts are remembered in
+// the cache tc (if any).
+void resolve_pending(Pending *q, HashTable *ht, TokenCache *tc, Offenses *o) {
+  char word[MAX_PARSER_LINE_LENGTH + 1];
+  uint32_t len = 0;
+  while (pending_pop(q, word, &len)) {
+    Node *n = ht_lookup(ht, word, len);
+    if (tc) {
+      tc_insert(tc, word, len, n);
+    }
+    if (n) {
+      record_offense(o, word, n);
+    }
+  }
+}
+
+// Called by the automaton for each match. Adds the word (or phrase) to the
+// right offense list. Every match of the same oldspeak has the same
+// fingerprint (0), since nothing hashes these lists.
+void record_match(char *oldspeak, uint32_t len, char *newspeak, void *arg) {
+  Offenses *o = (Offenses *)arg;
+  if (newspeak == NULL) { // If it's only oldspeak, then thought crime
+    ll_insert(o->thought_crime, oldspeak, NULL, len, 0);
+  } else { // If both, then rightspeak crime
+    ll_insert(o->rightspeak, oldspeak, newspeak, len, 0);
+  }
+}
+
+// Runs the Aho-Corasick engine: compiles the dictionary files into an
+// automaton and scans the raw bytes of stdin with it in one pass. If
+// boundaries is true, words and phrases only match as whole words, which
+// gives the same offenses as the word by word scan for ASCII text. Returns 1
+// if the dictionary couldn't be loaded.
+int scan_automaton(bool boundaries, uint32_t stats) {
+  Automaton *ac = ac_create(boundaries);
+  Offenses *o = offenses_create(NULL);
+  if (ac == NULL || o == NULL || !ac_load(ac, BADSPEAK_FILE, NEWSPEAK_FILE) ||
+      !ac_build(ac)) {
+    printf("can't open file\n");
+    ac_delete(&ac);
+    offenses_delete(&o);
+    return 1;
+  }
+  char buf[SCAN_BUFFER];
+  size_t n;
+  while ((n = fread(buf, 1, SCAN_BUFFER, stdin)) > 0) {
+    ac_scan(ac, buf, n, record_match, o);
+  }
+  ac_finish(ac, record_match, o);
+
+  if (stats == 0) {
+    print_punishment(o->thought_crime, o->rightspeak);
+  } else {
+    uint64_t bytes = 0;
+    uint64_t matches = 0;
+    ac_stats(ac, &bytes, &matches);
+    fprintf(stdout,
+            "ac patterns: %u\nac states: %u\nac table bytes: %lu\nac bytes "
+            "scanned: %lu\nac matches: %lu\n",
+            ac_patterns(ac), ac_states(ac), ac_table_bytes(ac), bytes, matches);
+  }
+  ac_delete(&ac);
+  offenses_delete(&o);
+  return 0;
+}
+
 // int main(void) {  test(); return 0;}
 
+// Compiles the dictionary files into a trie and writes it to path, so that
+// later runs can map it with --trie instead of reading the files
+int compile_trie(char *path) {
+  Trie *t = trie_load(BADSPEAK_FILE, NEWSPEAK_FILE);
+  if (t == NULL) {
+    printf("can't open file\n");
+    return 1;
+  }
+  if (!trie_save(t, path)) {
+    fprintf(stderr, "./banhammer: Can't write the trie file %s.\n", path);
+    trie_delete(&t);
+    return 1;
+  }
+  printf("%lu words, %lu cells, %lu bytes\n", trie_keys(t), trie_cells(t),
+         trie_size(t));
+  trie_delete(&t);
+  return 0;
+}
+
+// Compiles the dictionary files into a trie and writes it to path as C source,
+// which the banhammer-static target builds into the program
+int emit_static(char *path) {
+  Trie *t = trie_load(BADSPEAK_FILE, NEWSPEAK_FILE);
+  if (t == NULL) {
+    printf("can't open file\n");
+    return 1;
+  }
+  if (!trie_write_c(t, path, "static_dict")) {
+    fprintf(stderr, "./banhammer: Can't write %s.\n", path);
+    trie_delete(&t);
+    return 1;
+  }
+  trie_delete(&t);
+  return 0;
+}
+
+// Compiles the dictionary files into a hash file at path, so that later runs
+// can look words up in it with --disk without reading them into memory
+int compile_disk(char *path) {
+  if (!dh_build(BADSPEAK_FILE, NEWSPEAK_FILE, path)) {
+    fprintf(stderr, "./banhammer: Can't build the hash file %s.\n", path);
+    return 1;
+  }
+  DiskHash *dh = dh_open(path);
+  if (dh == NULL) {
+    fprintf(stderr, "./banhammer: Can't map the hash file %s.\n", path);
+    return 1;
+  }
+  printf("%lu words, %lu buckets, %lu bytes\n", dh_keys(dh), dh_buckets(dh),
+         dh_size(dh));
+  dh_delete(&dh);
+  return 0;
+}
+
+// Compiles the dictionary files into a trie and publishes it under name, so
+// that every worker process started with --shm maps the same copy. Workers
+// running with -r switch to it, the others on their next start.
+int publish_shm(char *name) {
+  Trie *t = trie_load(BADSPEAK_FILE, NEWSPEAK_FILE);
+  if (t == NULL) {
+    printf("can't open file\n");
+    return 1;
+  }
+  uint64_t generation = 0;
+  if (!shm_publish(name, t, &generation)) {
+    fprintf(stderr, "./banhammer: Can't publish the shared dictionary %s.\n",
+            name);
+    trie_delete(&t);
+    return 1;
+  }
+  printf("%s generation %lu: %lu words, %lu bytes\n", name, generation,
+         trie_keys(t), trie_size(t));
+  trie_delete(&t);
+  return 0;
+}
+
 // Main function of the program
 // Takes user input, and prints a message with the badspeak and
 // oldspeak-newspeak pairs
 int main(int argc, char **argv) {
+  uint64_t launched = now_ns();
   int opt = 0; // used for getopt
   // set default numbers
   uint32_t ht_size = 10000;
   uint64_t bf_sizes = pow(2, 19);
   uint32_t mtf = 0;
   uint32_t stats = 0;
-  LinkedList *thought_crime =
-      ll_create(true); // Holds all the words for thought crime
-  LinkedList *rightspeak =
-      ll_create(true); // Holds all the words for rightspeak crime
+  uint32_t counting = 0;
+  uint32_t reload = 0;
+  uint32_t threads = 1;
+  uint32_t engine = 0; // 1 = Aho-Corasick, 2 = Aho-Corasick without bounds
+  // The salts are random unless a seed is given, so inputs can't be crafted
+  // to collide
+  seed_random();
+  uint32_t max_level = CPU_AVX512; // Use the best kernels the CPU supports
+  char *hash = "auto";
+  uint32_t bench_hash = 0;
+  uint32_t cache_entries = TC_DEFAULT_ENTRIES;
+  char *batch = NULL;
+  uint64_t result_cache = RC_DEFAULT_MB;
+  char *profile = NULL;
+  char *trie = NULL;
+  char *build_trie = NULL;
+  char *emit = NULL;
+  char *shm = NULL;
+  char *shm_publish_name = NULL;
+  bool fast_start = false;
+  uint32_t load_threads = 1;
+  char *shm_remove_name = NULL;
+  char *disk = NULL;
+  char *build_disk = NULL;
+  char *bench_disk_path = NULL;
+  uint32_t input = INPUT_STDIO;
+  uint32_t normalize = 0;
+  bool bench_norm = false;
+  struct option long_options[] = {{"seed", required_argument, NULL, SEED_OPTION},
+                                  {"cpu", required_argument, NULL, CPU_OPTION},
+                                  {"hash", required_argument, NULL, HASH_OPTION},
+                                  {"bench-hash", no_argument, NULL,
+                                   BENCH_HASH_OPTION},
+                                  {"cache", required_argument, NULL,
+                                   CACHE_OPTION},
+                                  {"batch", required_argument, NULL,
+                                   BATCH_OPTION},
+                                  {"result-cache", required_argument, NULL,
+                                   RESULT_CACHE_OPTION},
+                                  {"profile", required_argument, NULL,
+                                   PROFILE_OPTION},
+                                  {"trie", required_argument, NULL,
+                                   TRIE_OPTION},
+                                  {"fast-start", no_argument, NULL,
+                                   FAST_START_OPTION},
+                                  {"load-threads", required_argument, NULL,
+                                   LOAD_THREADS_OPTION},
+                                  {"build-trie", required_argument, NULL,
+                                   BUILD_TRIE_OPTION},
+                                  {"emit-static", required_argument, NULL,
+                                   EMIT_STATIC_OPTION},
+                                  {"shm", required_argument, NULL, SHM_OPTION},
+                                  {"shm-publish", required_argument, NULL,
+                                   SHM_PUBLISH_OPTION},
+                                  {"shm-remove", required_argument, NULL,
+                                   SHM_REMOVE_OPTION},
+                                  {"disk", required_argument, NULL,
+                                   DISK_OPTION},
+                                  {"build-disk", required_argument, NULL,
+                                   BUILD_DISK_OPTION},
+                                  {"bench-disk", required_argument, NULL,
+                                   BENCH_DISK_OPTION},
+                                  {"input", required_argument, NULL,
+                                   INPUT_OPTION},
+                                  {"normalize", required_argument, NULL,
+                                   NORMALIZE_OPTION},
+                                  {"bench-normalize", no_argument, NULL,
+                                   BENCH_NORMALIZE_OPTION},
+                                  {NULL, 0, NULL, 0}};
   //int false_positive = 0;
 
   // gets user input and runs until processes all the commands
-  while ((opt = getopt(argc, argv, "t:f:msh")) !=
+  while ((opt = getopt_long(argc, argv, "t:f:mcrj:aAsh", long_options, NULL)) !=
          -1) { // list of valid commands
     // sets the size of the hash table
     if (opt == 't') {
@@ -116,15 +501,11 @@ int main(int argc, char **argv) {
     if (opt == 'f') {
     	if (optarg[0] == '-') { 
          fprintf(stderr, "./banhammer: Invalid bloom filter table size.\n");
-         ll_delete(&rightspeak);
-  	ll_delete(&thought_crime);
          return 1;
       }
       bf_sizes = strtoul(optarg, NULL, 10);
       if (bf_sizes <= 0) {
       	fprintf(stderr, "./banhammer: Invalid bloom filter table size.\n");
-      	ll_delete(&rightspeak);
-  	ll_delete(&thought_crime);
       	return 1;
       }
     }
@@ -132,6 +513,140 @@ int main(int argc, char **argv) {
     if (opt == 'm') {
       mtf = 1;
     }
+    // enables the counting Bloom filter
+    if (opt == 'c') {
+      counting = 1;
+    }
+    // enables hot reload of the dictionary files
+    if (opt == 'r') {
+      reload = 1;
+    }
+    // sets the number of lookup threads
+    if (opt == 'j') {
+      threads = strtoul(optarg, NULL, 10);
+      if (optarg[0] == '-' || threads == 0 || threads > MAX_SCAN_THREADS) {
+        fprintf(stderr, "./banhammer: Invalid number of threads.\n");
+        return 1;
+      }
+    }
+    // selects the Aho-Corasick engine (whole words, or anywhere with -A)
+    if (opt == 'a') {
+      engine = 1;
+    }
+    if (opt == 'A') {
+      engine = 2;
+    }
+    // sets the seed of the salts
+    if (opt == SEED_OPTION) {
+      seed_set(strtoull(optarg, NULL, 0));
+    }
+    // caps the instruction set of the kernels
+    if (opt == CPU_OPTION) {
+      max_level = cpu_level_parse(optarg);
+      if (max_level == UINT32_MAX) {
+        fprintf(stderr, "./banhammer: Invalid instruction set.\n");
+        return 1;
+      }
+    }
+    // picks the hash backend
+    if (opt == HASH_OPTION) {
+      hash = optarg;
+    }
+    // sets the size of the token cache
+    if (opt == CACHE_OPTION) {
+      if (optarg[0] == '-') {
+        fprintf(stderr, "./banhammer: Invalid cache size.\n");
+        return 1;
+      }
+      cache_entries = strtoul(optarg, NULL, 10);
+    }
+    // scans many documents instead of stdin
+    if (opt == BATCH_OPTION) {
+      batch = optarg;
+    }
+    // sets the memory limit of the result cache of the batch mode
+    if (opt == RESULT_CACHE_OPTION) {
+      if (optarg[0] == '-') {
+        fprintf(stderr, "./banhammer: Invalid result cache size.\n");
+        return 1;
+      }
+      result_cache = strtoull(optarg, NULL, 10);
+    }
+    // times the stages of the scan loop
+    if (opt == PROFILE_OPTION) {
+      if (!prof_supported(optarg)) {
+        fprintf(stderr, "./banhammer: Invalid profile format or not a "
+                        "PROFILE build.\n");
+        return 1;
+      }
+      profile = optarg;
+    }
+    // looks words up in a compiled trie, or compiles one
+    if (opt == TRIE_OPTION) {
+      trie = optarg;
+    }
+    if (opt == BUILD_TRIE_OPTION) {
+      build_trie = optarg;
+    }
+    if (opt == EMIT_STATIC_OPTION) {
+      emit = optarg;
+    }
+    // starts scanning before the hash table is built
+    if (opt == FAST_START_OPTION) {
+      fast_start = true;
+    }
+    // builds the dictionary with many threads
+    if (opt == LOAD_THREADS_OPTION) {
+      load_threads = strtoul(optarg, NULL, 10);
+      if (optarg[0] == '-' || load_threads == 0 ||
+          load_threads > MAX_SCAN_THREADS) {
+        fprintf(stderr, "./banhammer: Invalid number of threads.\n");
+        return 1;
+      }
+    }
+    // shares the dictionary between processes
+    if (opt == SHM_OPTION) {
+      shm = optarg;
+    }
+    if (opt == SHM_PUBLISH_OPTION) {
+      shm_publish_name = optarg;
+    }
+    if (opt == SHM_REMOVE_OPTION) {
+      shm_remove_name = optarg;
+    }
+    // looks words up in a hash file on disk, builds one or benchmarks one
+    if (opt == DISK_OPTION) {
+      disk = optarg;
+    }
+    if (opt == BUILD_DISK_OPTION) {
+      build_disk = optarg;
+    }
+    if (opt == BENCH_DISK_OPTION) {
+      bench_disk_path = optarg;
+    }
+    // picks the engine that reads stdin
+    if (opt == INPUT_OPTION) {
+      input = input_engine_parse(optarg);
+      if (input == UINT32_MAX) {
+        fprintf(stderr, "./banhammer: Invalid input engine.\n");
+        return 1;
+      }
+    }
+    // normalizes the words while tokenizing, or benchmarks it
+    if (opt == NORMALIZE_OPTION) {
+      normalize = norm_parse(optarg);
+      if (normalize == UINT32_MAX) {
+        fprintf(stderr, "./banhammer: Invalid normalization.\n");
+        return 1;
+      }
+    }
+    if (opt == BENCH_NORMALIZE_OPTION) {
+      bench_norm = true;
+    }
+    // runs the hash benchmark
+    if (opt == BENCH_HASH_OPTION) {
+      bench_hash = 1;
+    }
     // enables display of statistics
     if (opt == 's') {
       stats = 1;
@@ -142,133 +657,429 @@ int main(int argc, char **argv) {
       return 0;
     }
     // if it's not in the above options, return an error number
-    if (opt != 'h' && opt != 't' && opt != 'f' && opt != 'm' && opt != 's') {
+    if (opt != 'h' && opt != 't' && opt != 'f' && opt != 'm' && opt != 'c' &&
+        opt != 'r' && opt != 'j' && opt != 'a' && opt != 'A' && opt != 's' &&
+        opt != SEED_OPTION && opt != CPU_OPTION && opt != HASH_OPTION &&
+        opt != BENCH_HASH_OPTION && opt != CACHE_OPTION &&
+        opt != BATCH_OPTION && opt != RESULT_CACHE_OPTION &&
+        opt != PROFILE_OPTION && opt != TRIE_OPTION &&
+        opt != BUILD_TRIE_OPTION && opt != EMIT_STATIC_OPTION &&
+        opt != SHM_OPTION && opt != SHM_PUBLISH_OPTION &&
+        opt != SHM_REMOVE_OPTION && opt != FAST_START_OPTION &&
+        opt != LOAD_THREADS_OPTION && opt != DISK_OPTION &&
+        opt != BUILD_DISK_OPTION && opt != BENCH_DISK_OPTION &&
+        opt != INPUT_OPTION && opt != NORMALIZE_OPTION &&
+        opt != BENCH_NORMALIZE_OPTION) {
       print_error();
-      ll_delete(&rightspeak);
-      ll_delete(&thought_crime);
       return 1;
     }
   }
+  // Only the single-threaded stdin scan is timed
+  if (profile && (threads > 1 || batch || engine != 0)) {
+    fprintf(stderr, "./banhammer: --profile can't be used with -j, --batch, "
+                    "-a or -A.\n");
+    return 1;
+  }
 
-  // Creates all the needed structures
-  BloomFilter *bf = bf_create(bf_sizes);
-  HashTable *ht = ht_create(ht_size, mtf);
+  // Binds the hashing and tokenizing kernels for this CPU, and sets up the
+  // normalization before any dictionary is read
+  cpu_init(max_level);
+  norm_init(normalize);
+  if (!hash_select(hash)) {
+    fprintf(stderr, "./banhammer: Invalid hash or not supported by this CPU.\n");
+    return 1;
+  }
+  if (bench_hash) {
+    return bench_hashes(ht_size, bf_sizes);
+  }
 
-  // Reads in from badspeak file and inserts them to the Bloom Filter & Hash
-  // Table
-  FILE *f = fopen("badspeak.txt", "r");
-  if (f == NULL) {
-  	printf("can't open file\n");
-  	return 1;
+  if (bench_disk_path) {
+    return bench_disk(bench_disk_path);
   }
-  Parser *p = parser_create(f);
-  char word[MAX_PARSER_LINE_LENGTH + 1] = "";
-  while (next_word(p, word)) {
-    bf_insert(bf, word);
-    ht_insert(ht, word, NULL);
+  if (bench_norm) {
+    return bench_normalize();
   }
 
-  // Reads in from newspeak file and inserts them to the Bloom Filter & Hash
-  // Table accordingly
-  FILE *new = fopen("newspeak.txt", "r");
-  if (new == NULL) {
-  	printf("can't open file\n");
-  	return 1;
+  if (build_trie) {
+    return compile_trie(build_trie);
+  }
+  if (build_disk) {
+    return compile_disk(build_disk);
+  }
+  if (emit) {
+    return emit_static(emit);
+  }
+  if (shm_publish_name) {
+    return publish_shm(shm_publish_name);
+  }
+  if (shm_remove_name) {
+    if (!shm_remove(shm_remove_name)) {
+      fprintf(stderr, "./banhammer: No shared dictionary %s.\n",
+              shm_remove_name);
+      return 1;
+    }
+    return 0;
   }
-  Parser *np = parser_create(new);
-  char oldspeak[MAX_PARSER_LINE_LENGTH + 1] = "";
-  char newspeak[MAX_PARSER_LINE_LENGTH + 1] = "";
-  while (next_word(np, oldspeak) && next_word(np, newspeak)) {
-    bf_insert(bf, oldspeak);
-    ht_insert(ht, oldspeak, newspeak);
+
+  // The Aho-Corasick engine doesn't use the Bloom filter and hash table
+  if (engine != 0) {
+    return scan_automaton(engine == 1, stats);
   }
 
-  // Reads values from stdin
+  // Creates all the needed structures and reads in the badspeak words and
+  // oldspeak-newspeak pairs. banhammer-static uses the dictionary it was
+  // built with instead, unless --trie, --shm or --disk names another one. A
+  // shared dictionary can follow new generations with -r, a trie or hash file
+  // can't.
+#ifdef STATIC_DICT
+  bool builtin = trie == NULL && shm == NULL && disk == NULL;
+#else
+  bool builtin = false;
+#endif
+  if ((trie || builtin) && reload) {
+    fprintf(stderr, "./banhammer: -r can't be used with a trie.\n");
+    return 1;
+  }
+  if (disk && reload) {
+    fprintf(stderr, "./banhammer: -r can't be used with a hash file.\n");
+    return 1;
+  }
+  // Unless stdin is read with stdio, its first blocks are read (or
+  // decompressed) while the dictionary loads (in batch mode it may hold the
+  // list of documents instead). With stdio, that is only done if it is
+  // compressed, which its first bytes tell.
+  Input *in = NULL;
   FILE *std = stdin;
-  Parser *ip = parser_create(std);
-  while (!feof(std)) {
-    if (next_word(ip, oldspeak)) {
-     if (mystrcmps(oldspeak, " ") || mystrcmps(oldspeak, "\n") || mystrcmps(oldspeak, "")) {
-          continue;
+  if (input == INPUT_STDIO && batch == NULL) {
+    in = input_stdio(STDIN_FILENO, &std, INPUT_DEPTH, INPUT_BLOCK);
+  } else if (batch == NULL) {
+    in = input_create(STDIN_FILENO, input, INPUT_DEPTH, INPUT_BLOCK);
+  }
+  if (batch == NULL) {
+    if (in == NULL && (input != INPUT_STDIO || std == NULL)) {
+      fprintf(stderr, "./banhammer: Can't read stdin with %s.\n",
+              input_engine_name(input));
+      return 1;
+    }
+    if (in && !decomp_supported(input_format(in))) {
+      fprintf(stderr, "./banhammer: stdin is %s compressed, but this build "
+                      "can't decompress it.\n",
+              decomp_name(input_format(in)));
+      return 1;
+    }
+  }
+  Dictionary *dict = dict_create(ht_size, bf_sizes, mtf, counting);
+  if (dict && trie && !dict_open_trie(dict, trie)) {
+    fprintf(stderr, "./banhammer: Can't map the trie file %s, or it was "
+                    "built with another --normalize.\n",
+            trie);
+    return 1;
+  }
+  if (dict && disk && !dict_open_disk(dict, disk)) {
+    fprintf(stderr, "./banhammer: Can't map the hash file %s, or it was "
+                    "built with another --normalize.\n",
+            disk);
+    return 1;
+  }
+  if (dict && shm && !dict_attach_shm(dict, shm)) {
+    fprintf(stderr, "./banhammer: Can't attach the shared dictionary %s, or "
+                    "it was published with another --normalize.\n",
+            shm);
+    return 1;
+  }
+#ifdef STATIC_DICT
+  if (dict && builtin &&
+      !dict_set_trie(dict, trie_static(static_dict, static_dict_size))) {
+    fprintf(stderr, "./banhammer: The built-in dictionary is corrupt, or "
+                    "was built with another --normalize.\n");
+    return 1;
+  }
+#endif
+  // With --fast-start, only the single-threaded stdin scan starts before the
+  // hash table is built, the others need all of it. Otherwise the dictionary
+  // is built with --load-threads threads.
+  fast_start = fast_start && threads == 1 && batch == NULL && !reload;
+  bool loaded = dict && (dict_trie(dict) != NULL || dict_disk(dict) != NULL);
+  if (dict && !loaded && fast_start) {
+    loaded = dict_load_fast(dict, BADSPEAK_FILE, NEWSPEAK_FILE);
+  } else if (dict && !loaded) {
+    loaded = dict_load_parallel(dict, BADSPEAK_FILE, NEWSPEAK_FILE,
+                                load_threads);
+  }
+  if (!loaded) {
+    printf("can't open file\n");
+    return 1;
+  }
+  // With hot reload, the dictionary is rebuilt in the background and each word
+  // is looked up in whichever generation is current when it is read (one
+  // reader per lookup thread)
+  Reloader *reloader = NULL;
+  if (reload && batch == NULL) {
+    reloader = reloader_create(dict, threads);
+  }
+  BloomFilter *bf = dict_bf(dict);
+  HashTable *ht = dict_ht(dict);
+
+  // Everything the scan needs is allocated here: the offense lists get room
+  // for every word of the dictionary, and the words are read into the scratch
+  // buffer of the context. Most words are common ones, so their verdicts are
+  // remembered in a small cache that is checked before the Bloom filter (a
+  // trie is fast enough to be looked up directly, and a hash file has its own
+  // Bloom filter in memory).
+  if (dict_trie(dict) || dict_disk(dict)) {
+    cache_entries = 0;
+  }
+  Offenses *o = offenses_create(dict);
+  ScanContext *ctx = scan_context_create(
+      threads == 1 && batch == NULL ? cache_entries : 0);
+  if (o == NULL || ctx == NULL) {
+    fprintf(stderr, "./banhammer: Failed to allocate memory.\n");
+    return 1;
+  }
+  TokenCache *tc = scan_cache(ctx);
+  Trie *words = dict_trie(dict);
+  DiskHash *dh = dict_disk(dict);
+  if (tc) {
+    tc_use(tc, dict_id(dict));
+  }
+  // Until the hash table is built, the words that hit the Bloom filter wait
+  // in a queue (or the scan waits, if it is full or can't be allocated)
+  Pending *pending = NULL;
+  if (!dict_ready(dict)) {
+    pending = pending_create(PENDING_DEFAULT_BYTES);
+  }
+  bool waiting = pending != NULL;
+  if (!waiting) {
+    dict_wait(dict);
+  }
+
+  // The stages of the loop below are timed from here on, so the dictionary
+  // load isn't counted
+  if (profile && !prof_start(profile)) {
+    fprintf(stderr, "./banhammer: Failed to start the profiler.\n");
+    return 1;
+  }
+
+  // Reads values from stdin
+  uint64_t started = now_ns();
+  uint64_t first_token = started;
+  char *oldspeak = scan_word(ctx);
+  Counters *counters = scan_counters(ctx);
+  Parser *ip = in ? parser_create_input(in) : parser_create(std);
+  // With more than one thread, the input is split in blocks that are scanned
+  // at the same time. The lookups don't write to the shared dictionary, so the
+  // stats are kept per thread and added up in total.
+  Counters total;
+  counters_clear(&total);
+  // In batch mode the dictionary is loaded once for all the documents
+  if (batch && batch_scan(batch, dict, threads, cache_entries,
+                          result_cache << 20, stats == 0, &total) != 0) {
+    fprintf(stderr, "./banhammer: Can't read the documents of %s.\n", batch);
+    return 1;
+  }
+  if (threads > 1 && batch == NULL &&
+      scan_parallel(dict, reloader, threads, cache_entries, std, in, o,
+                    &total) != 0) {
+    fprintf(stderr, "./banhammer: Failed to start the lookup threads.\n");
+    return 1;
+  }
+  uint64_t reserved = dict_id(dict); // The Dictionary o has room for
+  // The loop runs until the Parser has no words left, which can be after
+  // the input hit its end (the last line may not end with a newline). The
+  // tokenizer gives the length of each word with it.
+  uint32_t len = 0;
+  for (uint64_t start = prof_now();
+       threads == 1 && batch == NULL && next_word(ip, oldspeak, &len);
+       start = prof_now()) {
+    // Once the first line was read, nothing is allocated per word
+    alloc_guard(true);
+    // Words never hold spaces or newlines, so only skip the empty ones
+    if (oldspeak[0] == '\0') {
+      continue;
+    }
+    if (counters->tokens == 0) {
+      first_token = now_ns();
+    }
+    counters->tokens += 1;
+    // Once the hash table is built, the words that waited for it go first
+    if (waiting && dict_ready(dict)) {
+      resolve_pending(pending, ht, tc, o);
+      waiting = false;
+    }
+    if (reloader) {
+      Dictionary *d = reloader_enter(reloader, 0);
+      bf = dict_bf(d);
+      ht = dict_ht(d);
+      words = dict_trie(d);
+      if (tc) {
+        tc_use(tc, dict_id(d));
+      }
+      // A new generation may have more words than the offenses have room
+      if (dict_id(d) != reserved) {
+        alloc_guard(false);
+        offenses_reserve(o, d);
+        alloc_guard(true);
+        reserved = dict_id(d);
       }
+    }
 
-      if (bf_probe(bf, oldspeak) ==
-          true) { // Checks if the word is already in the Bloom Filter
-           //   printf("%s\n", oldspeak);
-        Node *n = ht_lookup(ht, oldspeak); // If it is, find the right node
-                                           // associated with the oldspeak
-        if (n) {
-          if (n->newspeak ==
-              NULL) { // If it's only oldspeak, then thought crime
-            ll_insert(thought_crime, oldspeak, NULL);
-          } else { // If both, then rightspeak crime
-            ll_insert(rightspeak, oldspeak, n->newspeak);
-          }
-        }
+    Node *n = NULL;
+    uint64_t t = prof_now();
+    // If the word isn't in the cache, look it up and remember the verdict
+    bool cached = tc != NULL && tc_lookup(tc, oldspeak, len, &n);
+    t = tc ? prof_lap(PROF_CACHE, t) : t;
+    if (words) {
+      n = scan_trie(ctx, words, oldspeak, len);
+      t = prof_lap(PROF_TABLE, t);
+    } else if (dh) {
+      n = scan_disk(ctx, dh, oldspeak, len);
+      t = prof_lap(PROF_TABLE, t);
+    } else if (!cached) {
+      // Checks the Bloom Filter with the length the tokenizer gave, keeping
+      // its stats with the other counters of the scan
+      bool maybe = bf_probe_r(bf, oldspeak, len, counters);
+      t = prof_lap(PROF_BLOOM, t);
+      // While the hash table is being built, the word waits for it (or if
+      // the queue is full, the scan does)
+      if (maybe && waiting && !pending_push(pending, oldspeak, len)) {
+        dict_wait(dict);
+        resolve_pending(pending, ht, tc, o);
+        waiting = false;
+      }
+      bool deferred = maybe && waiting;
+      if (maybe && !deferred) {
+        // If it is, find the right node associated with the oldspeak
+        n = ht_lookup(ht, oldspeak, len);
+        t = prof_lap(PROF_TABLE, t);
       }
+      if (tc && !deferred) {
+        tc_insert(tc, oldspeak, len, n);
+        t = prof_lap(PROF_CACHE, t);
+      }
+    }
+    // The offenses of a hash file may outgrow their arena, which is then
+    // grown before the word is recorded
+    if (n && dh) {
+      alloc_guard(false);
+      offenses_headroom(o);
+      alloc_guard(true);
     }
+    if (n) {
+      record_offense(o, oldspeak, n);
+      prof_lap(PROF_RECORD, t);
+    }
+    if (reloader) {
+      reloader_exit(reloader, 0);
+    }
+    prof_lap(PROF_WORD, start);
+  }
+  alloc_guard(false);
+  if (waiting) {
+    dict_wait(dict);
+    resolve_pending(pending, ht, tc, o);
+  }
+  if (profile) {
+    prof_dump(stderr);
+  }
+  counters->bytes += parser_bytes(ip);
+  counters_add(&total, scan_counters(ctx));
+  uint64_t elapsed = now_ns() - started;
+  // The statistics are those of the generation that is current now
+  Dictionary *current = reloader ? reloader_enter(reloader, 0) : dict;
+
+  // A corrupt input (or one that couldn't be read to its end) isn't judged
+  // by the part of it that could be read
+  if ((in && input_failed(in) && input_format(in) == DECOMP_NONE) ||
+      (in == NULL && ferror(std))) {
+    fprintf(stderr, "./banhammer: Can't read stdin.\n");
+    parser_delete(&ip);
+    return 1;
+  }
+  if (in && input_failed(in)) {
+    fprintf(stderr, "./banhammer: Can't decompress stdin: it is corrupt or "
+                    "cut short.\n");
+    parser_delete(&ip); // Also stops the decoder thread
+    return 1;
   }
 
   // Prints the right messages based on the crimes
   if (stats == 0) {
-    if ((ll_length(thought_crime) > 0) && (ll_length(rightspeak) > 0)) {
-      printf("%s", mixspeak_message);
-      ll_print(thought_crime);
-      ll_print(rightspeak);
-    } else if (ll_length(thought_crime) > 0) {
-      printf("%s", badspeak_message);
-      ll_print(thought_crime);
-    } else if (ll_length(rightspeak) > 0) {
-      printf("%s", goodspeak_message);
-      ll_print(rightspeak);
-    }
+    print_punishment(o->thought_crime, o->rightspeak);
   }
   // Prints stats
   if (stats == 1) {
-    uint32_t bnk = 0;
-    uint32_t bnh = 0;
-    uint32_t bnm = 0;
-    uint32_t bne = 0;
-    uint32_t hnk = 0;
-    uint32_t hnh = 0;
-    uint32_t hnm = 0;
-    uint32_t hne = 0;
-    bf_stats(bf, &bnk, &bnh, &bnm, &bne);
-    ht_stats(ht, &hnk, &hnh, &hnm, &hne);
-    fprintf(stdout, "ht keys: %u\nht hits: %u\nht misses: %u\nht probes: %u\n",
-            hnk, hnh, hnm, hne);
+    // The counters of the lookup threads and those of the shared structures
+    // (sequential scan) are gathered in one snapshot
+    Snapshot snap;
+    dict_snapshot(current, &total, elapsed, &snap);
+    Counters *c = &snap.counters;
     fprintf(stdout,
-            "bf keys: %u\nbf hits: %u\nbf misses: %u\nbf bits examined: %u\n",
-            bnk, bnh, bnm, bne); 
-    double bepm;
-    if (bnm == 0) {
-      bepm = 0;
-    } else {
-      bepm = (bne - (5 * bnh)) / (double)bnm;
-    }
-    double fp;
-    if (bnh == 0) {
-      fp = 0;
-    } else {
-      fp = (double)hnm / bnh;
-    }
-    double bfl;
-    if (bf_size(bf) == 0) {
-      bfl = 0;
-    } else {
-      bfl = (double)((bf_count(bf))) / (bf_size(bf));
-    }
-    double asl;
-    if (hnh + hnm == 0) {
-      asl = 0;
-    } else {
-      asl = ((double)hne) / (hnh + hnm);
-    }
+            "ht keys: %lu\nht hits: %lu\nht misses: %lu\nht probes: %lu\n",
+            snap.ht_keys, c->ht_hits, c->ht_misses, c->ht_examined);
+    fprintf(stdout,
+            "bf keys: %lu\nbf hits: %lu\nbf misses: %lu\nbf bits examined: "
+            "%lu\n",
+            snap.bf_keys, c->bf_hits, c->bf_misses, c->bf_bits_examined);
     fprintf(
         stdout,
         "Bits examined per miss: %.6lf\nFalse positives: %.6lf\nAverage seek "
         "length: %.6lf\nBloom filter load: %.6lf\n",
-        bepm, fp, asl, bfl); 
+        snap.bits_per_miss, snap.false_positives, snap.seek_length,
+        snap.bf_load);
+    fprintf(stdout,
+            "ht max chain: %lu\nht rehashes: %lu\nseed: %lu\ncpu: %s\nhash: "
+            "%s\n",
+            snap.ht_max_chain, snap.ht_rehashes, seed_get(),
+            cpu_level_name(kernels.level), hash_name());
+    fprintf(stdout, "cache hits: %lu\ncache misses: %lu\ncache hit rate: %.6lf\n",
+            c->cache_hits, c->cache_misses, snap.cache_hit_rate);
+    if (batch) {
+      fprintf(stdout, "result cache hits: %lu\nresult cache misses: %lu\n",
+              c->result_hits, c->result_misses);
+    }
+    if (words) {
+      fprintf(stdout,
+              "trie keys: %lu\ntrie cells: %lu\ntrie bytes: %lu\ntrie hits: "
+              "%lu\ntrie misses: %lu\n",
+              snap.trie_keys, snap.trie_cells, snap.trie_size, c->trie_hits,
+              c->trie_misses);
+    }
+    if (normalize) {
+      char names[64];
+      norm_names(normalize, names, sizeof(names));
+      fprintf(stdout, "normalize: %s\n", names);
+    }
+    if (in) {
+      fprintf(stdout, "input: %s\ninput format: %s\ninput waits: %lu\n",
+              input_engine_name(input_engine(in)),
+              decomp_name(input_format(in)), input_waits(in));
+    }
+    if (dh) {
+      fprintf(stdout,
+              "disk keys: %lu\ndisk buckets: %lu\ndisk bytes: %lu\ndisk hits: "
+              "%lu\ndisk misses: %lu\ndisk misses filtered: %lu\ndisk pages "
+              "read: %lu\n",
+              snap.disk_keys, snap.disk_buckets, snap.disk_size, c->disk_hits,
+              c->disk_misses, c->disk_filtered, c->disk_pages);
+    }
+    if (shm) {
+      fprintf(stdout, "shm generation: %lu\n", dict_generation(current));
+    }
+    fprintf(stdout,
+            "tokens: %lu\nbytes scanned: %lu\nscan time: %.6lf s\ntokens per "
+            "second: %.0lf\nMB per second: %.2lf\n",
+            c->tokens, c->bytes, snap.elapsed_ns / 1e9, snap.tokens_per_sec,
+            snap.bytes_per_sec / 1e6);
+    if (threads == 1 && batch == NULL) {
+      fprintf(stdout, "time to first token: %.6lf s\n",
+              (first_token - launched) / 1e9);
+    }
+    if (pending) {
+      fprintf(stdout, "words put off: %lu\n", pending_count(pending));
+    }
+#ifdef ALLOC_CHECK
+    fprintf(stdout, "heap allocations: %lu\n", alloc_count());
+#endif
 
     // Used for bash:
        //fprintf(stdout, "%lu %.6lf\n", bf_sizes, fp); //false positive
@@ -277,13 +1088,16 @@ int main(int argc, char **argv) {
   }
 
   // Delete all structures and frees memory
-  ll_delete(&rightspeak);
-  ll_delete(&thought_crime);
-  bf_delete(&bf);
-  ht_delete(&ht);
-  parser_delete(&p);
-  parser_delete(&np);
+  offenses_delete(&o);
+  scan_context_delete(&ctx);
+  if (reloader) {
+    reloader_exit(reloader, 0);
+    reloader_delete(&reloader); // Also deletes the current dictionary
+  } else {
+    dict_delete(&dict);
+  }
   parser_delete(&ip);
+  pending_delete(&pending);
 
   return 0;
 }
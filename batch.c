@@ -0,0 +1,401 @@
+#include "batch.h"
+#include "cpu.h"
+#include "decomp.h"
+#include "ll.h"
+#include "parser.h"
+#include "pool.h"
+#include "rc.h"
+#include "scan.h"
+#include "tc.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define BATCH_MMAP (1 << 16) // Documents at least this big are mmap'd
+#define BATCH_BUFFER 4096
+#define BATCH_KEEP (1 << 20) // A bigger buffer is freed after its document
+#define BATCH_MAX_TEXT (64 << 20) // Most a compressed document may expand to
+
+// The verdict of a document: how many different badspeak words and oldspeak
+// words it has, or error if it couldn't be read.
+typedef struct Verdict Verdict;
+
+struct Verdict {
+  Result result;
+  bool error;
+};
+
+// What each thread scans with: its own ScanContext, the offenses of the
+// document it is scanning, and a buffer for the documents that are read
+// instead of mmap'd (size bytes).
+typedef struct BatchWorker BatchWorker;
+
+struct BatchWorker {
+  ScanContext *ctx;
+  Offenses *offenses;
+  char *buf;
+  uint64_t size;
+};
+
+// Defines what members/fields a Batch has.
+// paths holds the n_paths documents to scan (room for cap of them), and
+// verdicts the verdict of each one. All threads share the Dictionary d and
+// the ResultCache rc (NULL if there is none).
+typedef struct Batch Batch;
+
+struct Batch {
+  char **paths;
+  uint64_t n_paths;
+  uint64_t cap;
+  Verdict *verdicts;
+  Dictionary *dict;
+  ResultCache *rc;
+  BatchWorker *workers;
+};
+
+// Adds a copy of path to the documents of the batch
+static bool add_path(Batch *b, const char *path) {
+  if (b->n_paths == b->cap) {
+    uint64_t cap = b->cap ? 2 * b->cap : BATCH_BUFFER;
+    char **paths = (char **)realloc(b->paths, cap * sizeof(char *));
+    if (paths == NULL) {
+      return false;
+    }
+    b->paths = paths;
+    b->cap = cap;
+  }
+  b->paths[b->n_paths] = strdup(path);
+  if (b->paths[b->n_paths] == NULL) {
+    return false;
+  }
+  b->n_paths += 1;
+  return true;
+}
+
+// Adds every regular file under the directory dir (and its subdirectories)
+static bool add_dir(Batch *b, const char *dir) {
+  DIR *d = opendir(dir);
+  if (d == NULL) {
+    return false;
+  }
+  bool ok = true;
+  struct dirent *e;
+  while (ok && (e = readdir(d)) != NULL) {
+    if (strcmp(e->d_name, ".") == 0 || strcmp(e->d_name, "..") == 0) {
+      continue;
+    }
+    char *path = (char *)malloc(strlen(dir) + strlen(e->d_name) + 2);
+    if (path == NULL) {
+      ok = false;
+      break;
+    }
+    sprintf(path, "%s/%s", dir, e->d_name);
+    struct stat st;
+    if (lstat(path, &st) == 0) {
+      if (S_ISDIR(st.st_mode)) {
+        ok = add_dir(b, path);
+      } else if (S_ISREG(st.st_mode)) {
+        ok = add_path(b, path);
+      }
+    }
+    free(path);
+  }
+  closedir(d);
+  return ok;
+}
+
+// Adds the paths listed in a file, one per line ("-" reads them from stdin)
+static bool add_list(Batch *b, const char *list) {
+  FILE *f = strcmp(list, "-") == 0 ? stdin : fopen(list, "r");
+  if (f == NULL) {
+    return false;
+  }
+  bool ok = true;
+  char *line = NULL;
+  size_t size = 0;
+  ssize_t n;
+  while (ok && (n = getline(&line, &size, f)) != -1) {
+    if (n > 0 && line[n - 1] == '\n') {
+      line[n - 1] = '\0';
+    }
+    if (line[0] != '\0') {
+      ok = add_path(b, line);
+    }
+  }
+  free(line);
+  if (f != stdin) {
+    fclose(f);
+  }
+  return ok;
+}
+
+// Used to sort the documents of a directory by path
+static int compare_paths(const void *a, const void *b) {
+  return strcmp(*(char *const *)a, *(char *const *)b);
+}
+
+// Makes sure the buffer of the worker can hold size bytes, plus the '\0' and
+// slack that scan_text needs after them
+static bool reserve(BatchWorker *w, uint64_t size) {
+  if (w->size < size + 1 + CPU_SPAN_PAD) {
+    uint64_t new_size = w->size ? w->size : BATCH_BUFFER;
+    while (new_size < size + 1 + CPU_SPAN_PAD) {
+      new_size *= 2;
+    }
+    char *buf = (char *)realloc(w->buf, new_size);
+    if (buf == NULL) {
+      return false;
+    }
+    w->buf = buf;
+    w->size = new_size;
+  }
+  return true;
+}
+
+// Reads all of the file fd into the buffer of the worker. Sets n to its length.
+static bool read_all(BatchWorker *w, int fd, uint64_t size, uint64_t *n) {
+  *n = 0;
+  if (!reserve(w, size)) {
+    return false;
+  }
+  while (true) {
+    // The size may have changed since fstat, so read until the end of file
+    if (*n + BATCH_BUFFER + 1 + CPU_SPAN_PAD > w->size &&
+        !reserve(w, *n + BATCH_BUFFER)) {
+      return false;
+    }
+    ssize_t r = read(fd, w->buf + *n, w->size - 1 - CPU_SPAN_PAD - *n);
+    if (r < 0) {
+      return false;
+    }
+    if (r == 0) {
+      break;
+    }
+    *n += r;
+  }
+  w->buf[*n] = '\0';
+  return true;
+}
+
+// Decompresses all of the file fd, of format, into the buffer of the worker.
+// The first n_head bytes of it were read into head. Sets n to the length of
+// the text. A text of more than BATCH_MAX_TEXT bytes (such as a gzip bomb) is
+// refused, like a corrupt one.
+static bool read_compressed(BatchWorker *w, int fd, uint32_t format,
+                            char *head, uint64_t n_head, uint64_t *n) {
+  *n = 0;
+  Decoder *d = decoder_create(fd, format, head, n_head);
+  bool ok = d != NULL;
+  while (ok) {
+    uint64_t want = *n + DECOMP_BUFFER;
+    ok = reserve(w, want < BATCH_MAX_TEXT ? want : BATCH_MAX_TEXT);
+    uint64_t room = w->size - 1 - CPU_SPAN_PAD - *n;
+    room = *n + room < BATCH_MAX_TEXT ? room : BATCH_MAX_TEXT - *n;
+    uint64_t r = ok ? decoder_read(d, w->buf + *n, room) : 0;
+    *n += r;
+    if (r < room) {
+      break;
+    }
+    // Once the text fills the limit, there must be nothing more of it
+    if (*n == BATCH_MAX_TEXT) {
+      char more;
+      ok = decoder_read(d, &more, 1) == 0;
+      break;
+    }
+  }
+  ok = ok && !decoder_failed(d);
+  if (ok) {
+    w->buf[*n] = '\0';
+  }
+  decoder_delete(&d);
+  return ok;
+}
+
+// Scans a mmap'd document. The mapping isn't followed by a '\0' and slack, so
+// it is only scanned in place up to a character that can't be in a word at
+// least CPU_SPAN_PAD bytes before its end. The rest is copied to the buffer.
+static bool scan_mapped(Batch *b, BatchWorker *w, char *data,
+                        uint64_t size) {
+  uint64_t cut = size - CPU_SPAN_PAD;
+  while (cut > 0 && word_char(data[cut - 1])) {
+    cut -= 1;
+  }
+  if (!reserve(w, size - cut)) {
+    return false;
+  }
+  scan_text(data, cut, b->dict, w->ctx, w->offenses);
+  memcpy(w->buf, data + cut, size - cut);
+  w->buf[size - cut] = '\0';
+  scan_text(w->buf, size - cut, b->dict, w->ctx, w->offenses);
+  return true;
+}
+
+// Gets the verdict of a document that is in memory (mapped if it's mmap'd).
+// If the same bytes were scanned before, the verdict and the offenses come
+// from the result cache. Else, the document is scanned with a cleared set of
+// offenses, and its verdict and offenses are added to the cache. Either way,
+// the offenses of the worker are then those of the document. Returns false if
+// it couldn't be scanned.
+static bool judge(Batch *b, BatchWorker *w, char *data, uint64_t size,
+                  bool mapped, Verdict *v) {
+  uint128 key = {0, 0};
+  Counters *c = scan_counters(w->ctx);
+  Offenses *o = w->offenses;
+  offenses_clear(o);
+  if (b->rc) {
+    key = rc_key(b->rc, data, size);
+    if (rc_lookup(b->rc, key, &v->result, o->thought_crime, o->rightspeak)) {
+      c->result_hits += 1;
+      return true;
+    }
+    c->result_misses += 1;
+  }
+  bool ok = true;
+  if (mapped) {
+    ok = scan_mapped(b, w, data, size);
+  } else {
+    scan_text(data, size, b->dict, w->ctx, w->offenses);
+  }
+  if (ok) {
+    v->result.thought_crime = ll_length(o->thought_crime);
+    v->result.rightspeak = ll_length(o->rightspeak);
+    if (b->rc) {
+      rc_insert(b->rc, key, &v->result, o->thought_crime, o->rightspeak);
+    }
+  }
+  return ok;
+}
+
+// Frees the buffer of the worker if a document made it grow past BATCH_KEEP,
+// so a worker doesn't hold on to the memory of its biggest document
+static void shrink(BatchWorker *w) {
+  if (w->size > BATCH_KEEP) {
+    free(w->buf);
+    w->buf = NULL;
+    w->size = 0;
+  }
+}
+
+// Gets the verdict of one document (a task of the pool). Big documents are
+// mmap'd, the others are read. Compressed documents are decompressed into the
+// buffer of the worker (or are an error, if this build can't or they expand
+// to more than BATCH_MAX_TEXT bytes).
+static void scan_document(uint32_t worker, uint64_t task, void *arg) {
+  Batch *b = (Batch *)arg;
+  BatchWorker *w = &b->workers[worker];
+  Verdict *v = &b->verdicts[task];
+  v->error = true;
+  int fd = open(b->paths[task], O_RDONLY);
+  if (fd < 0) {
+    return;
+  }
+  struct stat st;
+  char head[DECOMP_MAGIC];
+  ssize_t n_head = pread(fd, head, DECOMP_MAGIC, 0);
+  uint32_t format = n_head > 0 ? decomp_detect(head, n_head) : DECOMP_NONE;
+  if (format != DECOMP_NONE) {
+    uint64_t size = 0;
+    if (lseek(fd, n_head, SEEK_SET) == n_head &&
+        read_compressed(w, fd, format, head, n_head, &size)) {
+      v->error = !judge(b, w, w->buf, size, false, v);
+    }
+    shrink(w);
+  } else if (fstat(fd, &st) == 0) {
+    uint64_t size = st.st_size;
+    if (S_ISREG(st.st_mode) && size >= BATCH_MMAP) {
+      char *data = (char *)mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (data != MAP_FAILED) {
+        madvise(data, size, MADV_SEQUENTIAL);
+        v->error = !judge(b, w, data, size, true, v);
+        munmap(data, size);
+      }
+    } else if (read_all(w, fd, size, &size)) {
+      v->error = !judge(b, w, w->buf, size, false, v);
+    }
+  }
+  close(fd);
+}
+
+// Returns the name of the verdict: the message the document would get
+static const char *verdict_name(Verdict *v) {
+  if (v->error) {
+    return "error";
+  } else if (v->result.thought_crime > 0 && v->result.rightspeak > 0) {
+    return "mixspeak";
+  } else if (v->result.thought_crime > 0) {
+    return "badspeak";
+  } else if (v->result.rightspeak > 0) {
+    return "goodspeak";
+  }
+  return "clean";
+}
+
+// Scans many documents against the dictionary d, which is loaded only once.
+// source is either a directory, whose files are all scanned (sorted by path),
+// or a file that lists the paths of the documents, one per line ("-" for
+// stdin). The documents are spread over n_threads threads, and each one gets
+// its own set of offenses. If verdicts is true, one line is printed per
+// document, in order: the verdict, the number of different badspeak and
+// oldspeak words, and the path. Documents with the same bytes as one that was
+// already scanned get its verdict from a result cache of at most cache_bytes
+// bytes (none if 0). The stats of all threads are added to total.
+// Returns 1 if source couldn't be read. Else, return 0.
+int batch_scan(char *source, Dictionary *d, uint32_t n_threads,
+               uint32_t cache_entries, uint64_t cache_bytes, bool verdicts,
+               Counters *total) {
+  Batch b = {NULL, 0, 0, NULL, d, rc_create(cache_bytes), NULL};
+  struct stat st;
+  bool ok;
+  if (strcmp(source, "-") != 0 && stat(source, &st) == 0 &&
+      S_ISDIR(st.st_mode)) {
+    ok = add_dir(&b, source);
+    if (ok) {
+      qsort(b.paths, b.n_paths, sizeof(char *), compare_paths);
+    }
+  } else {
+    ok = add_list(&b, source);
+  }
+
+  if (ok) {
+    b.verdicts = (Verdict *)calloc(b.n_paths + 1, sizeof(Verdict));
+    b.workers = (BatchWorker *)calloc(n_threads, sizeof(BatchWorker));
+    ok = b.verdicts && b.workers;
+  }
+  for (uint32_t i = 0; ok && i < n_threads; i += 1) {
+    b.workers[i].ctx = scan_context_create(cache_entries);
+    b.workers[i].offenses = offenses_create(d);
+    ok = b.workers[i].ctx && b.workers[i].offenses;
+  }
+  if (ok) {
+    ok = pool_run(n_threads, b.n_paths, scan_document, &b);
+  }
+  for (uint32_t i = 0; b.workers && i < n_threads; i += 1) {
+    BatchWorker *w = &b.workers[i];
+    if (ok) {
+      counters_add(total, scan_counters(w->ctx));
+    }
+    scan_context_delete(&w->ctx);
+    offenses_delete(&w->offenses);
+    free(w->buf);
+  }
+
+  for (uint64_t i = 0; i < b.n_paths; i += 1) {
+    if (ok && verdicts) {
+      Verdict *v = &b.verdicts[i];
+      printf("%s\t%u\t%u\t%s\n", verdict_name(v), v->result.thought_crime,
+             v->result.rightspeak, b.paths[i]);
+    }
+    free(b.paths[i]);
+  }
+  free(b.paths);
+  free(b.verdicts);
+  free(b.workers);
+  rc_delete(&b.rc);
+  return ok ? 0 : 1;
+}
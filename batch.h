@@ -0,0 +1,14 @@
+#ifndef __BATCH_H__
+#define __BATCH_H__
+
+#include "dict.h"
+#include "stats.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+int batch_scan(char *source, Dictionary *d, uint32_t n_threads,
+               uint32_t cache_entries, uint64_t cache_bytes, bool verdicts,
+               Counters *total);
+
+#endif
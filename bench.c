@@ -0,0 +1,418 @@
+#include "bench.h"
+#include "arena.h"
+#include "bf.h"
+#include "cpu.h"
+#include "dh.h"
+#include "dict.h"
+#include "hash.h"
+#include "ht.h"
+#include "node.h"
+#include "norm.h"
+#include "parser.h"
+#include "trie.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/resource.h>
+#include <time.h>
+#include <unistd.h>
+
+#define N_PROBES 100000
+#define N_HASH_CALLS 2000000
+#define N_CHAIN_BINS 9
+#define N_LOOKUPS 2000000
+#define N_DISK_SAMPLE 100000
+#define N_NORM_BYTES (256ULL << 20)
+
+// The dictionary keys the benchmarks use: each word zero padded to
+// NODE_INLINE bytes (in arena), with its length
+typedef struct WordList WordList;
+
+struct WordList {
+  char **words;
+  uint32_t *lens;
+  uint32_t n;
+  uint32_t cap;
+  Arena *arena;
+};
+
+// Adds a copy of word to the list
+static void add_word(WordList *wl, char *word) {
+  if (wl->n == wl->cap) {
+    wl->cap = wl->cap ? wl->cap * 2 : 1024;
+    wl->words = (char **)realloc(wl->words, sizeof(char *) * wl->cap);
+    wl->lens = (uint32_t *)realloc(wl->lens, sizeof(uint32_t) * wl->cap);
+  }
+  uint32_t len = strlen(word);
+  uint32_t size = len + 1 < NODE_INLINE ? NODE_INLINE : len + 1;
+  char *w = (char *)arena_alloc(wl->arena, size);
+  memset(w, 0, size);
+  memcpy(w, word, len);
+  wl->words[wl->n] = w;
+  wl->lens[wl->n] = len;
+  wl->n += 1;
+}
+
+// Reads the keys of the dictionary files: every badspeak word and the
+// oldspeak of every pair (or only every step-th one, to sample a dictionary
+// too big to keep in memory). Returns false if a file can't be opened.
+static bool load_words(WordList *wl, uint64_t step) {
+  uint64_t seen = 0;
+  char word[MAX_PARSER_LINE_LENGTH + 1] = "";
+  char newspeak[MAX_PARSER_LINE_LENGTH + 1] = "";
+  uint32_t len = 0;
+  uint32_t new_len = 0;
+  FILE *f = fopen(BADSPEAK_FILE, "r");
+  if (f == NULL) {
+    return false;
+  }
+  Parser *p = parser_create(f);
+  while (next_word(p, word, &len)) {
+    if (word[0] != '\0' && seen++ % step == 0) {
+      add_word(wl, word);
+    }
+  }
+  parser_delete(&p);
+  FILE *new = fopen(NEWSPEAK_FILE, "r");
+  if (new == NULL) {
+    return false;
+  }
+  Parser *np = parser_create(new);
+  while (next_word(np, word, &len) && next_newspeak(np, newspeak, &new_len)) {
+    if (word[0] != '\0' && seen++ % step == 0) {
+      add_word(wl, word);
+    }
+  }
+  parser_delete(&np);
+  return true;
+}
+
+// Returns a monotonic time in nanoseconds
+static double now_ns(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec * 1e9 + t.tv_nsec;
+}
+
+// Returns the ns per lookup of the words of wl in the dictionary, with the
+// hash table alone (engine 0), the Bloom filter then the hash table (1), or
+// the trie (2). Adds the number of words found to found.
+static double time_lookups(WordList *wl, uint32_t engine, BloomFilter *bf,
+                           HashTable *ht, Trie *trie, uint64_t *found) {
+  double start = now_ns();
+  uint64_t n = 0;
+  while (n < N_LOOKUPS) {
+    for (uint32_t i = 0; i < wl->n; i += 1) {
+      char *w = wl->words[i];
+      if (engine == 0) {
+        *found += ht_lookup(ht, w, wl->lens[i]) != NULL;
+      } else if (engine == 1) {
+        *found += bf_probe(bf, w) && ht_lookup(ht, w, wl->lens[i]) != NULL;
+      } else {
+        *found += trie_lookup(trie, w, wl->lens[i]) >= 0;
+      }
+    }
+    n += wl->n;
+  }
+  return (now_ns() - start) / n;
+}
+
+// Compares the time per lookup of the dictionary words (hits) and the probes
+// (misses) in the hash table, the Bloom filter and hash table, and a trie
+// built from the same files, with the bound hash
+static void bench_lookups(WordList *wl, WordList *probes, uint32_t ht_size,
+                          uint32_t bf_size) {
+  BloomFilter *bf = bf_create(bf_size, false);
+  HashTable *ht = ht_create(ht_size, false);
+  Trie *trie = trie_load(BADSPEAK_FILE, NEWSPEAK_FILE);
+  if (bf == NULL || ht == NULL || trie == NULL || wl->n == 0) {
+    bf_delete(&bf);
+    ht_delete(&ht);
+    trie_delete(&trie);
+    return;
+  }
+  for (uint32_t i = 0; i < wl->n; i += 1) {
+    bf_insert(bf, wl->words[i]);
+    ht_insert(ht, wl->words[i], NULL);
+  }
+  char *names[] = {"ht", "bf+ht", "trie"};
+  printf("lookups (%s): ns/hit ns/miss\n", hash_name());
+  for (uint32_t e = 0; e < 3; e += 1) {
+    uint64_t found = 0;
+    double hit = time_lookups(wl, e, bf, ht, trie, &found);
+    double miss = time_lookups(probes, e, bf, ht, trie, &found);
+    printf("  %-6s %.2f %.2f%s\n", names[e], hit, miss,
+           found == 42 ? " " : ""); // Keeps the lookups alive
+  }
+  printf("  trie: %lu cells, %lu bytes (%.1f per word)\n", trie_cells(trie),
+         trie_size(trie), (double)trie_size(trie) / trie_keys(trie));
+  bf_delete(&bf);
+  ht_delete(&ht);
+  trie_delete(&trie);
+}
+
+// Benchmarks every hash backend the CPU can run: the time per hash for keys
+// of several lengths, and the Bloom filter false positive rate and hash table
+// chain lengths it gives on the dictionary (with the -f and -t sizes). Then
+// compares the hash table and trie lookups.
+// Returns 1 if the dictionary couldn't be read.
+int bench_hashes(uint32_t ht_size, uint32_t bf_size) {
+  WordList wl = {NULL, NULL, 0, 0, arena_create(65536)};
+  if (!load_words(&wl, 1)) {
+    printf("can't open file\n");
+    arena_delete(&wl.arena);
+    return 1;
+  }
+  // Random lowercase words that aren't in the dictionary, to probe with
+  WordList probes = {NULL, NULL, 0, 0, arena_create(65536)};
+  HashTable *keys = ht_create(ht_size, false);
+  for (uint32_t i = 0; i < wl.n; i += 1) {
+    ht_insert(keys, wl.words[i], NULL);
+  }
+  srand(1);
+  while (probes.n < N_PROBES) {
+    char w[NODE_INLINE] = "";
+    uint32_t len = 3 + rand() % 10;
+    for (uint32_t i = 0; i < len; i += 1) {
+      w[i] = 'a' + rand() % 26;
+    }
+    if (ht_lookup(keys, w, len) == NULL) {
+      add_word(&probes, w);
+    }
+  }
+  ht_delete(&keys);
+  // Random bytes the timing loop takes keys from
+  char bytes[1024];
+  for (uint32_t i = 0; i < sizeof(bytes); i += 1) {
+    bytes[i] = rand();
+  }
+  uint32_t lengths[] = {1, 2, 4, 8, 12, 16, 24, 32, 64, 128};
+  uint32_t n_lengths = sizeof(lengths) / sizeof(uint32_t);
+
+  printf("%u dictionary words, %u probes of words not in it\n", wl.n,
+         probes.n);
+  hash64_fn bound = kernels.hash64;
+  for (uint32_t b = 0; b < n_hash_backends; b += 1) {
+    if (hash_backends[b].level > kernels.level) {
+      continue;
+    }
+    kernels.hash64 = hash_backends[b].fn;
+    printf("hash: %s\n  ns/hash by key length:", hash_backends[b].name);
+    uint64_t sink = 0;
+    for (uint32_t l = 0; l < n_lengths; l += 1) {
+      double start = now_ns();
+      for (uint32_t i = 0; i < N_HASH_CALLS; i += 1) {
+        sink += kernels.hash64(bytes + (i & 511), lengths[l], i);
+      }
+      printf(" %u:%.2f", lengths[l], (now_ns() - start) / N_HASH_CALLS);
+    }
+    printf("%s\n", sink == 42 ? " " : ""); // Keeps sink (and the loop) alive
+
+    // Bloom filter false positives and chain lengths on the dictionary
+    BloomFilter *bf = bf_create(bf_size, false);
+    HashTable *ht = ht_create(ht_size, false);
+    for (uint32_t i = 0; i < wl.n; i += 1) {
+      bf_insert(bf, wl.words[i]);
+      ht_insert(ht, wl.words[i], NULL);
+    }
+    uint32_t fp = 0;
+    for (uint32_t i = 0; i < probes.n; i += 1) {
+      fp += bf_probe(bf, probes.words[i]);
+    }
+    printf("  bf false positives: %.6lf (%u/%u)\n", (double)fp / probes.n, fp,
+           probes.n);
+    uint32_t hist[N_CHAIN_BINS];
+    ht_chain_lengths(ht, hist, N_CHAIN_BINS);
+    printf("  ht chain lengths:");
+    for (uint32_t i = 0; i < N_CHAIN_BINS; i += 1) {
+      printf(" %u%s:%u", i, i == N_CHAIN_BINS - 1 ? "+" : "", hist[i]);
+    }
+    printf(" (max %lu)\n", ht_max_chain(ht));
+    bf_delete(&bf);
+    ht_delete(&ht);
+  }
+  kernels.hash64 = bound;
+  bench_lookups(&wl, &probes, ht_size, bf_size);
+  free(wl.words);
+  free(wl.lens);
+  arena_delete(&wl.arena);
+  free(probes.words);
+  free(probes.lens);
+  arena_delete(&probes.arena);
+  return 0;
+}
+
+// Returns the number of major page faults (pages read from the disk) of the
+// process so far
+static uint64_t major_faults(void) {
+  struct rusage ru;
+  getrusage(RUSAGE_SELF, &ru);
+  return ru.ru_majflt;
+}
+
+// Shuffles the words of wl, so they are looked up in no particular order
+static void shuffle(WordList *wl) {
+  for (uint32_t i = wl->n; i > 1; i -= 1) {
+    uint32_t j = rand() % i;
+    char *w = wl->words[i - 1];
+    uint32_t len = wl->lens[i - 1];
+    wl->words[i - 1] = wl->words[j];
+    wl->lens[i - 1] = wl->lens[j];
+    wl->words[j] = w;
+    wl->lens[j] = len;
+  }
+}
+
+// Looks up every word of wl once in the hash file dh and prints the lookups
+// per second, the pages read per lookup and the major faults they took. If
+// cold is set, the hash file is first dropped from the page cache.
+static void time_disk(DiskHash *dh, WordList *wl, char *name, bool cold) {
+  char newspeak[MAX_PARSER_LINE_LENGTH + 1];
+  Counters c;
+  counters_clear(&c);
+  if (cold) {
+    dh_evict(dh);
+  }
+  uint64_t faults = major_faults();
+  double start = now_ns();
+  for (uint32_t i = 0; i < wl->n; i += 1) {
+    dh_lookup(dh, wl->words[i], wl->lens[i], newspeak, &c);
+  }
+  double seconds = (now_ns() - start) / 1e9;
+  printf("  %-4s %-6s %12.0f %10.3f %10lu %8lu\n", cold ? "cold" : "warm",
+         name, seconds > 0 ? wl->n / seconds : 0,
+         (double)c.disk_pages / wl->n, major_faults() - faults, c.disk_hits);
+}
+
+// Benchmarks the lookups in the hash file at path (written by --build-disk):
+// a sample of the dictionary words (hits) and random words (misses), in
+// random order, each first with the file out of the page cache (cold, the
+// pages come from the disk) and then in it (warm).
+// Returns 1 if the hash file or the dictionary files can't be read.
+int bench_disk(char *path) {
+  DiskHash *dh = dh_open(path);
+  if (dh == NULL) {
+    fprintf(stderr, "./banhammer: Can't map the hash file %s.\n", path);
+    return 1;
+  }
+  WordList wl = {NULL, NULL, 0, 0, arena_create(65536)};
+  if (!load_words(&wl, dh_keys(dh) / N_DISK_SAMPLE + 1) || wl.n == 0) {
+    printf("can't open file\n");
+    arena_delete(&wl.arena);
+    dh_delete(&dh);
+    return 1;
+  }
+  srand(1);
+  shuffle(&wl);
+  // Random lowercase words that aren't in the dictionary, to probe with
+  WordList probes = {NULL, NULL, 0, 0, arena_create(65536)};
+  char newspeak[MAX_PARSER_LINE_LENGTH + 1];
+  Counters c;
+  counters_clear(&c);
+  while (probes.n < N_DISK_SAMPLE) {
+    char w[NODE_INLINE] = "";
+    uint32_t len = 3 + rand() % 10;
+    for (uint32_t i = 0; i < len; i += 1) {
+      w[i] = 'a' + rand() % 26;
+    }
+    if (dh_lookup(dh, w, len, newspeak, &c) == DH_MISS) {
+      add_word(&probes, w);
+    }
+  }
+  printf("%lu words, %lu buckets, %lu bytes on disk, %lu bytes of Bloom "
+         "filter in memory\n",
+         dh_keys(dh), dh_buckets(dh), dh_size(dh), dh_bloom_bytes(dh));
+  printf("  %u hits, %u misses: lookups/s pages/lookup major-faults found\n",
+         wl.n, probes.n);
+  time_disk(dh, &wl, "hits", true);
+  time_disk(dh, &wl, "hits", false);
+  time_disk(dh, &probes, "misses", true);
+  time_disk(dh, &probes, "misses", false);
+  free(wl.words);
+  free(wl.lens);
+  arena_delete(&wl.arena);
+  free(probes.words);
+  free(probes.lens);
+  arena_delete(&probes.arena);
+  dh_delete(&dh);
+  return 0;
+}
+
+// Reads all of fd into a buffer followed by a '\0' and CPU_SPAN_PAD bytes of
+// slack, like the blocks block_word scans, and sets n to its length. Returns
+// NULL if it couldn't be read or the memory couldn't be allocated.
+static char *read_all(int fd, uint64_t *n) {
+  uint64_t size = 1 << 20;
+  uint64_t len = 0;
+  char *buf = (char *)malloc(size + 1 + CPU_SPAN_PAD);
+  while (buf != NULL) {
+    if (len == size) {
+      size *= 2;
+      char *b = (char *)realloc(buf, size + 1 + CPU_SPAN_PAD);
+      if (b == NULL) {
+        break;
+      }
+      buf = b;
+    }
+    ssize_t r = read(fd, buf + len, size - len);
+    if (r <= 0) {
+      if (r == 0) {
+        memset(buf + len, 0, 1 + CPU_SPAN_PAD);
+        *n = len;
+        return buf;
+      }
+      break;
+    }
+    len += r;
+  }
+  free(buf);
+  return NULL;
+}
+
+// Benchmarks the tokenizer on the text of stdin with each kind of
+// normalization, then all of them, and prints the ns per byte each one takes,
+// the ns per byte it adds to the tokenizer without normalization, and how
+// many words it gives. The text is tokenized again and again until
+// N_NORM_BYTES were read, with block_word like scan_text does.
+// Returns 1 if stdin can't be read.
+int bench_normalize(void) {
+  uint64_t n = 0;
+  char *text = read_all(STDIN_FILENO, &n);
+  if (text == NULL || n == 0) {
+    fprintf(stderr, "./banhammer: Can't read the text to tokenize.\n");
+    free(text);
+    return 1;
+  }
+  uint32_t kinds[] = {0, NORM_LEET, NORM_DIACRITICS, NORM_CONFUSABLES,
+                      NORM_IGNORABLES, NORM_ALL};
+  uint32_t passes = N_NORM_BYTES / n + 1;
+  char word[MAX_PARSER_LINE_LENGTH + 1];
+  char name[64];
+  double base = 0;
+  printf("%lu bytes, %u passes (%s): ns/byte MB/s +ns/byte words\n", n, passes,
+         cpu_level_name(kernels.level));
+  for (uint32_t k = 0; k < sizeof(kinds) / sizeof(kinds[0]); k += 1) {
+    norm_init(kinds[k]);
+    uint64_t words = 0;
+    double start = now_ns();
+    for (uint32_t p = 0; p < passes; p += 1) {
+      uint64_t offset = 0;
+      uint32_t len = 0;
+      words = 0;
+      while (block_word(text, n, &offset, word, &len)) {
+        words += 1;
+      }
+    }
+    double per_byte = (now_ns() - start) / ((double)n * passes);
+    if (k == 0) {
+      base = per_byte;
+    }
+    norm_names(kinds[k], name, sizeof(name));
+    printf("  %-12s %8.3f %8.1f %+9.3f %10lu\n", name, per_byte,
+           per_byte > 0 ? 1e3 / per_byte : 0, per_byte - base, words);
+  }
+  norm_init(0);
+  free(text);
+  return 0;
+}
@@ -0,0 +1,12 @@
+#ifndef __BENCH_H__
+#define __BENCH_H__
+
+#include <stdint.h>
+
+int bench_hashes(uint32_t ht_size, uint32_t bf_size);
+
+int bench_disk(char *path);
+
+int bench_normalize(void);
+
+#endif
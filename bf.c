@@ -1,9 +1,13 @@
 #include "bf.h"
 #include "city.h"
+#include "cpu.h"
+#include "cv.h"
+#include "seed.h"
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #define N_HASHES 5
 
 // Defines what members/fields the BloomFilter structure has.
@@ -12,40 +16,43 @@
 // tracks the number of probes that return true. n_misses track the number of
 // probes that return false. n_bits_examined tracks that the total number of
 // bits examined (1-5 in each probe). filter is a BitVector that is associated
-// with the BloomFilter
+// with the BloomFilter. counters is used instead of filter when the
+// BloomFilter is a counting one (supports bf_remove), and filter is NULL.
 typedef struct BloomFilter BloomFilter;
 
 struct BloomFilter {
   uint64_t salts[N_HASHES];
-  uint32_t n_keys;
-  uint32_t n_hits;
-  uint32_t n_misses;
-  uint32_t n_bits_examined;
+  uint64_t n_keys;
+  uint64_t n_hits;
+  uint64_t n_misses;
+  uint64_t n_bits_examined;
   BitVector *filter;
+  CounterVector *counters;
 };
 
-// A static list that holds the default values for the 5 salts
-static uint64_t default_salts[] = {0x5adf08ae86d36f21, 0x419d292ea2ffd49e,
-                                   0x50d8bb08de3818df, 0x272347aea4045dd5,
-                                   0x7c8e16f768811a21};
-
-// The constructor for BloomFilter. Creates a new BloomFilter and returns a
-// pointer to it if the memory was allocated succesfully. Else, return NULL
-// Takes an uint32_t argument size  and set the length of the filter member to
-// it
-BloomFilter *bf_create(uint32_t size) {
+// Creates a BloomFilter like bf_create does, but with the given salts (or
+// salts from the per-process seed, if salts is NULL)
+static BloomFilter *create(uint32_t size, bool counting,
+                           const uint64_t *salts) {
   // Allocates memory for the new BloomFilter
   BloomFilter *bf = (BloomFilter *)malloc(sizeof(BloomFilter));
   // If the memory was allocated, set the members of it
   if (bf) {
     bf->n_keys = bf->n_hits = 0;
     bf->n_misses = bf->n_bits_examined = 0;
+    // The salts come from the per-process seed, so they can't be predicted
     for (int i = 0; i < N_HASHES; i++) {
-      bf->salts[i] = default_salts[i];
+      bf->salts[i] = salts ? salts[i] : seed_next();
+    }
+    // Try to create the BitVector filter (or the counters)
+    bf->filter = NULL;
+    bf->counters = NULL;
+    if (counting) {
+      bf->counters = cv_create(size);
+    } else {
+      bf->filter = bv_create(size);
     }
-    // Try to create the BitVector filter
-    bf->filter = bv_create(size);
-    if (bf->filter == NULL) {
+    if (bf->filter == NULL && bf->counters == NULL) {
       free(bf);
       bf = NULL;
     }
@@ -54,12 +61,29 @@ BloomFilter *bf_create(uint32_t size) {
   return bf;
 }
 
+// The constructor for BloomFilter. Creates a new BloomFilter and returns a
+// pointer to it if the memory was allocated succesfully. Else, return NULL
+// Takes an uint32_t argument size  and set the length of the filter member to
+// it. If counting is true, the filter keeps a 4-bit counter per index instead
+// of a bit so that keys can later be removed with bf_remove
+BloomFilter *bf_create(uint32_t size, bool counting) {
+  return create(size, counting, NULL);
+}
+
+// Creates an empty BloomFilter with the same size, kind and salts as bf, so
+// that it can be filled separately (by another thread) and merged into bf
+// with bf_merge. Returns NULL if the memory couldn't be allocated.
+BloomFilter *bf_create_like(BloomFilter *bf) {
+  return create(bf_size(bf), bf_counting(bf), bf->salts);
+}
+
 // The destructor for a BloomFilter.
 // Frees the BitVector member, frees the pointer to BloomFilter, and set it to
 // NULL
 void bf_delete(BloomFilter **bf) {
   if (*bf) {
     bv_delete(&((*bf)->filter));
+    cv_delete(&((*bf)->counters));
     free(*bf);
     *bf = NULL;
   }
@@ -67,27 +91,85 @@ void bf_delete(BloomFilter **bf) {
 
 // Returns the size of the BloomFilter.
 uint32_t bf_size(BloomFilter *bf) {
+  if (bf->counters) { // A counting filter has one counter per index
+    return cv_length(bf->counters);
+  }
   uint32_t l = bv_length(bf->filter); // The size is the length of its BitVector
   return l;
 }
 
+// Returns true if the BloomFilter supports bf_remove
+bool bf_counting(BloomFilter *bf) { return bf->counters != NULL; }
+
 // Inserts the argument oldspeak into the BloomFilter. Sets the right indecies
 // in the filter member to 1.
 void bf_insert(BloomFilter *bf, char *oldspeak) {
+  size_t len = strlen(oldspeak);
   // Hashes oldspeak with each of the salts
   for (uint64_t i = 0; i < N_HASHES; i += 1) {
-    uint64_t h = hash(bf->salts[i], oldspeak) % bf_size(bf);
-    bv_set_bit(bf->filter, h);
+    uint64_t h = kernels.hash64(oldspeak, len, bf->salts[i]) % bf_size(bf);
+    if (bf->counters) {
+      cv_inc(bf->counters, h);
+    } else {
+      bv_set_bit(bf->filter, h);
+    }
   }
   bf->n_keys += 1; // inputted a new key
 }
 
+// Merges the keys of src into dst, as if they had been inserted into dst: the
+// bits of src are ORed into dst (or the counters added, for counting filters).
+// Filters built by other threads with bf_create_like, or by other processes
+// with the same --seed and sizes, can be merged this way. Returns false (and
+// leaves dst alone) if the two don't have the same size, kind and salts.
+bool bf_merge(BloomFilter *dst, BloomFilter *src) {
+  if (bf_size(dst) != bf_size(src) || bf_counting(dst) != bf_counting(src) ||
+      memcmp(dst->salts, src->salts, sizeof(dst->salts)) != 0) {
+    return false;
+  }
+  if (dst->counters) {
+    cv_add(dst->counters, src->counters);
+  } else {
+    bv_or(dst->filter, src->filter);
+  }
+  dst->n_keys += src->n_keys;
+  return true;
+}
+
+// Removes the argument oldspeak from a counting BloomFilter by decrementing
+// the counters it was inserted into. Returns false (and changes nothing) for a
+// plain BloomFilter, since a bit can't tell how many keys set it, or if one of
+// the counters is already 0, which means oldspeak was never inserted.
+// The caller should only remove words that were inserted.
+bool bf_remove(BloomFilter *bf, char *oldspeak) {
+  size_t len = strlen(oldspeak);
+  if (bf->counters == NULL) {
+    return false;
+  }
+  uint64_t h[N_HASHES];
+  for (uint64_t i = 0; i < N_HASHES; i += 1) {
+    h[i] = kernels.hash64(oldspeak, len, bf->salts[i]) % bf_size(bf);
+    if (cv_get(bf->counters, h[i]) == 0) {
+      return false;
+    }
+  }
+  for (uint64_t i = 0; i < N_HASHES; i += 1) {
+    cv_dec(bf->counters, h[i]);
+  }
+  if (bf->n_keys > 0) {
+    bf->n_keys -= 1;
+  }
+  return true;
+}
+
 // Probes the BloomFilter for a given oldspeak word
 bool bf_probe(BloomFilter *bf, char *oldspeak) {
+  size_t len = strlen(oldspeak);
   // Hashes oldspeak with each of the salts
   for (uint64_t i = 0; i < N_HASHES; i += 1) {
-    uint64_t h = hash(bf->salts[i], oldspeak) % bf_size(bf);
-    uint8_t b = bv_get_bit(bf->filter, h);
+    uint64_t h = kernels.hash64(oldspeak, len, bf->salts[i]) % bf_size(bf);
+    uint8_t b = bf->counters ? (cv_get(bf->counters, h) != 0)
+                             : bv_get_bit(bf->filter, h);
     bf->n_bits_examined +=
         1; // Increase the number of bits examined since we look at another bit
     if (b == 0) { // If the bit is 0, no need to check the rest of the salts, so
@@ -101,13 +183,32 @@ bool bf_probe(BloomFilter *bf, char *oldspeak) {
   return true;
 }
 
+// Same as bf_probe, but the BloomFilter is only read and the stats are added
+// to the given Counters, so many threads can probe it at once.
+// len is the length of oldspeak.
+bool bf_probe_r(BloomFilter *bf, char *oldspeak, uint32_t len, Counters *c) {
+  for (uint64_t i = 0; i < N_HASHES; i += 1) {
+    uint64_t h = kernels.hash64(oldspeak, len, bf->salts[i]) % bf_size(bf);
+    uint8_t b = bf->counters ? (cv_get(bf->counters, h) != 0)
+                             : bv_get_bit(bf->filter, h);
+    c->bf_bits_examined += 1;
+    if (b == 0) {
+      c->bf_misses += 1;
+      return false;
+    }
+  }
+  c->bf_hits += 1;
+  return true;
+}
+
 // Return the number of set bits in the BloomFilter
 uint32_t bf_count(BloomFilter *bf) {
   uint32_t count = 0;
   // Goes through the filter BitVector, and counts the number of bits that are
   // equal to 1
   for (uint64_t i = 0; i < bf_size(bf); i += 1) {
-    if (bv_get_bit(bf->filter, i) == 1) {
+    if (bf->counters ? (cv_get(bf->counters, i) != 0)
+                     : (bv_get_bit(bf->filter, i) == 1)) {
       count += 1;
     }
   }
@@ -117,8 +218,13 @@ uint32_t bf_count(BloomFilter *bf) {
 // Prints the BloomFilter. Prints all members of the structure (keys, hits,
 // misses, bits examined, filter, and salts)
 void bf_print(BloomFilter *bf) {
-  bv_print(bf->filter); // Prints the BitVector member
-  printf("n_keys: %d, n_hits: %d, n_misses: %d, n_bits_examined: %d\nsalts: ",
+  if (bf->counters) {
+    cv_print(bf->counters); // Prints the counters of a counting filter
+  } else {
+    bv_print(bf->filter); // Prints the BitVector member
+  }
+  printf("n_keys: %lu, n_hits: %lu, n_misses: %lu, n_bits_examined: %lu\n"
+         "salts: ",
          bf->n_keys, bf->n_hits, bf->n_misses, bf->n_bits_examined);
   for (uint64_t i = 0; i < N_HASHES; i += 1) {
     printf("%lu", bf->salts[i]);
@@ -127,8 +233,8 @@ void bf_print(BloomFilter *bf) {
 }
 
 // Sets the arguments to the original value of the statistics
-void bf_stats(BloomFilter *bf, uint32_t *nk, uint32_t *nh, uint32_t *nm,
-              uint32_t *ne) {
+void bf_stats(BloomFilter *bf, uint64_t *nk, uint64_t *nh, uint64_t *nm,
+              uint64_t *ne) {
   *nk = bf->n_keys;
   *nh = bf->n_hits;
   *nm = bf->n_misses;
@@ -2,6 +2,7 @@
 #define __BF_H__
 
 #include "bv.h"
+#include "stats.h"
 
 #include <stdbool.h>
 #include <stdint.h>
@@ -10,20 +11,30 @@
 
 typedef struct BloomFilter BloomFilter;
 
-BloomFilter *bf_create(uint32_t size);
+BloomFilter *bf_create(uint32_t size, bool counting);
+
+BloomFilter *bf_create_like(BloomFilter *bf);
 
 void bf_delete(BloomFilter **bf);
 
+bool bf_merge(BloomFilter *dst, BloomFilter *src);
+
 uint32_t bf_size(BloomFilter *bf);
 
+bool bf_counting(BloomFilter *bf);
+
 void bf_insert(BloomFilter *bf, char *oldspeak);
 
+bool bf_remove(BloomFilter *bf, char *oldspeak);
+
 bool bf_probe(BloomFilter *bf, char *oldspeak);
 
+bool bf_probe_r(BloomFilter *bf, char *oldspeak, uint32_t len, Counters *c);
+
 uint32_t bf_count(BloomFilter *bf);
 
 void bf_print(BloomFilter *bf);
 
-void bf_stats(BloomFilter *bf, uint32_t *nk, uint32_t *nh, uint32_t *nm, uint32_t *ne);
+void bf_stats(BloomFilter *bf, uint64_t *nk, uint64_t *nh, uint64_t *nm, uint64_t *ne);
 
 #endif
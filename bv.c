@@ -1,4 +1,5 @@
 #include "bv.h"
+#include "cpu.h"
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -81,6 +82,16 @@ uint8_t bv_get_bit(BitVector *bv, uint32_t i) {
   return 0;
 }
 
+// Sets every bit of dst that is set in src, a word at a time with the or_words
+// kernel. Returns false (and leaves dst alone) if their lengths differ.
+bool bv_or(BitVector *dst, BitVector *src) {
+  if (dst->length != src->length) {
+    return false;
+  }
+  kernels.or_words(dst->vector, src->vector, (dst->length + 63) / 64);
+  return true;
+}
+
 // Prints all characteristics of the BitVector
 void bv_print(BitVector *bv) {
   // Goes through the entire BitVector, and prints each bit
@@ -1,6 +1,7 @@
 #ifndef __BV_H__
 #define __BV_H__
 
+#include <stdbool.h>
 #include <stdint.h>
 
 typedef struct BitVector BitVector;
@@ -17,6 +18,8 @@ void bv_clr_bit(BitVector *bv, uint32_t i);
 
 uint8_t bv_get_bit(BitVector *bv, uint32_t i);
 
+bool bv_or(BitVector *dst, BitVector *src);
+
 void bv_print(BitVector *bv);
 
 #endif
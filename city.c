@@ -444,12 +444,16 @@ uint128 CityHash128(const char *s, size_t len)
     }
 }
 
-#ifdef __SSE4_2__
+#if defined(__x86_64__)
 #include "citycrc.h"
 #include <nmmintrin.h>
 
+// The CRC functions are built for SSE4.2 even when the rest of the program
+// isn't; cpu.c only binds them when the CPU has it.
+#define CITY_CRC __attribute__((target("sse4.2")))
+
 // Requires len >= 240.
-static void CityHashCrc256Long(const char *s, size_t len,
+CITY_CRC static void CityHashCrc256Long(const char *s, size_t len,
                                uint32 seed, uint64 *result)
 {
     uint64 a = Fetch64(s + 56) + k0;
@@ -525,7 +529,7 @@ static void CityHashCrc256Long(const char *s, size_t len,
 }
 
 // Requires len < 240.
-static void CityHashCrc256Short(const char *s, size_t len, uint64 *result)
+CITY_CRC static void CityHashCrc256Short(const char *s, size_t len, uint64 *result)
 {
     char buf[240];
     memcpy(buf, s, len);
@@ -533,7 +537,7 @@ static void CityHashCrc256Short(const char *s, size_t len, uint64 *result)
     CityHashCrc256Long(buf, 240, ~(uint32)(len), result);
 }
 
-void CityHashCrc256(const char *s, size_t len, uint64 *result)
+CITY_CRC void CityHashCrc256(const char *s, size_t len, uint64 *result)
 {
     if (LIKELY(len >= 240))
     {
@@ -545,7 +549,7 @@ void CityHashCrc256(const char *s, size_t len, uint64 *result)
     }
 }
 
-uint128 CityHashCrc128WithSeed(const char *s, size_t len, uint128 seed)
+CITY_CRC uint128 CityHashCrc128WithSeed(const char *s, size_t len, uint128 seed)
 {
     if (len <= 900)
     {
@@ -564,7 +568,7 @@ uint128 CityHashCrc128WithSeed(const char *s, size_t len, uint128 seed)
     }
 }
 
-uint128 CityHashCrc128(const char *s, size_t len)
+CITY_CRC uint128 CityHashCrc128(const char *s, size_t len)
 {
     if (len <= 900)
     {
@@ -0,0 +1,191 @@
+#include "cpu.h"
+#include "city.h"
+#include "hash.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__x86_64__)
+#include "citycrc.h"
+#include <immintrin.h>
+#define CPU_TARGET(isa) __attribute__((target(isa)))
+#endif
+
+// Names of the instruction set levels, indexed by level
+static const char *level_names[] = {"scalar", "sse4.2", "avx2", "avx512"};
+
+// Returns true if c is a character next_word keeps in a word
+static inline bool is_word(uint8_t c) {
+  return (uint8_t)((c | 0x20) - 'a') < 26 || (uint8_t)(c - '0') < 10 ||
+         c == '\'' || c == '-';
+}
+
+// Returns the length of the run of word characters at the start of s, one
+// byte at a time
+static uint32_t span_scalar(const char *s) {
+  uint32_t n = 0;
+  while (is_word((uint8_t)s[n])) {
+    n += 1;
+  }
+  return n;
+}
+
+// ORs n words of src into dst, one word at a time
+static void or_scalar(uint64_t *dst, const uint64_t *src, size_t n) {
+  for (size_t i = 0; i < n; i += 1) {
+    dst[i] |= src[i];
+  }
+}
+
+#if defined(__x86_64__)
+// SSE4.2: PCMPISTRI finds the first byte outside the word ranges (or the end
+// of the string) in 16 bytes at a time
+CPU_TARGET("sse4.2") static uint32_t span_sse42(const char *s) {
+  const __m128i ranges =
+      _mm_setr_epi8('a', 'z', 'A', 'Z', '0', '9', '\'', '\'', '-', '-', 0, 0, 0,
+                    0, 0, 0);
+  for (uint32_t n = 0;; n += 16) {
+    __m128i x = _mm_loadu_si128((const __m128i *)(s + n));
+    int i = _mm_cmpistri(ranges, x,
+                         _SIDD_UBYTE_OPS | _SIDD_CMP_RANGES |
+                             _SIDD_NEGATIVE_POLARITY | _SIDD_LEAST_SIGNIFICANT);
+    if (i < 16) {
+      return n + i;
+    }
+  }
+}
+
+// AVX2: classifies 32 bytes at a time with range compares. Bytes >= 0x80 are
+// negative as signed bytes, so they fail every range.
+CPU_TARGET("avx2") static uint32_t span_avx2(const char *s) {
+  const __m256i case_bit = _mm256_set1_epi8(0x20);
+  for (uint32_t n = 0;; n += 32) {
+    __m256i x = _mm256_loadu_si256((const __m256i *)(s + n));
+    __m256i lower = _mm256_or_si256(x, case_bit);
+    __m256i alpha =
+        _mm256_and_si256(_mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)),
+                         _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), lower));
+    __m256i digit =
+        _mm256_and_si256(_mm256_cmpgt_epi8(x, _mm256_set1_epi8('0' - 1)),
+                         _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), x));
+    __m256i punct =
+        _mm256_or_si256(_mm256_cmpeq_epi8(x, _mm256_set1_epi8('\'')),
+                        _mm256_cmpeq_epi8(x, _mm256_set1_epi8('-')));
+    uint32_t word = (uint32_t)_mm256_movemask_epi8(
+        _mm256_or_si256(alpha, _mm256_or_si256(digit, punct)));
+    if (word != UINT32_MAX) {
+      return n + __builtin_ctz(~word);
+    }
+  }
+}
+
+// AVX-512BW: the same classification as AVX2, 64 bytes at a time, with the
+// results in mask registers
+CPU_TARGET("avx512bw") static uint32_t span_avx512(const char *s) {
+  for (uint32_t n = 0;; n += 64) {
+    __m512i x = _mm512_loadu_si512((const void *)(s + n));
+    __m512i lower = _mm512_or_si512(x, _mm512_set1_epi8(0x20));
+    __mmask64 alpha = _mm512_cmplt_epu8_mask(
+        _mm512_sub_epi8(lower, _mm512_set1_epi8('a')), _mm512_set1_epi8(26));
+    __mmask64 digit = _mm512_cmplt_epu8_mask(
+        _mm512_sub_epi8(x, _mm512_set1_epi8('0')), _mm512_set1_epi8(10));
+    __mmask64 punct = _mm512_cmpeq_epi8_mask(x, _mm512_set1_epi8('\'')) |
+                      _mm512_cmpeq_epi8_mask(x, _mm512_set1_epi8('-'));
+    uint64_t word = alpha | digit | punct;
+    if (word != UINT64_MAX) {
+      return n + __builtin_ctzll(~word);
+    }
+  }
+}
+
+// AVX2: ORs 4 words at a time, then the rest one by one
+CPU_TARGET("avx2")
+static void or_avx2(uint64_t *dst, const uint64_t *src, size_t n) {
+  size_t i = 0;
+  for (; i + 4 <= n; i += 4) {
+    __m256i a = _mm256_loadu_si256((const __m256i *)(dst + i));
+    __m256i b = _mm256_loadu_si256((const __m256i *)(src + i));
+    _mm256_storeu_si256((__m256i *)(dst + i), _mm256_or_si256(a, b));
+  }
+  or_scalar(dst + i, src + i, n - i);
+}
+
+// AVX-512: ORs 8 words at a time, then the rest one by one
+CPU_TARGET("avx512f")
+static void or_avx512(uint64_t *dst, const uint64_t *src, size_t n) {
+  size_t i = 0;
+  for (; i + 8 <= n; i += 8) {
+    __m512i a = _mm512_loadu_si512((const void *)(dst + i));
+    __m512i b = _mm512_loadu_si512((const void *)(src + i));
+    _mm512_storeu_si512((void *)(dst + i), _mm512_or_si512(a, b));
+  }
+  or_scalar(dst + i, src + i, n - i);
+}
+#endif
+
+// The kernels in use. They start out as the portable ones so that everything
+// works before cpu_init is called.
+Kernels kernels = {CPU_SCALAR, CityHash64WithSeed, CityHash128WithSeed,
+                   span_scalar, or_scalar};
+
+// Returns the highest instruction set level the CPU supports
+uint32_t cpu_detect(void) {
+  uint32_t level = CPU_SCALAR;
+#if defined(__x86_64__)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("sse4.2")) {
+    level = CPU_SSE42;
+    if (__builtin_cpu_supports("avx2")) {
+      level = CPU_AVX2;
+      if (__builtin_cpu_supports("avx512bw")) {
+        level = CPU_AVX512;
+      }
+    }
+  }
+#endif
+  return level;
+}
+
+// Binds the kernels for the best instruction set the CPU supports, but no
+// higher than max_level
+void cpu_init(uint32_t max_level) {
+  uint32_t level = cpu_detect();
+  if (level > max_level) {
+    level = max_level;
+  }
+  kernels.level = level;
+  kernels.hash64 = CityHash64WithSeed;
+  kernels.hash128 = CityHash128WithSeed;
+  kernels.word_span = span_scalar;
+  kernels.or_words = or_scalar;
+#if defined(__x86_64__)
+  if (level >= CPU_SSE42) {
+    kernels.hash64 = hash_crc32c;
+    kernels.hash128 = CityHashCrc128WithSeed;
+    kernels.word_span = span_sse42;
+  }
+  if (level >= CPU_AVX2) {
+    kernels.word_span = span_avx2;
+    kernels.or_words = or_avx2;
+  }
+  if (level >= CPU_AVX512) {
+    kernels.word_span = span_avx512;
+    kernels.or_words = or_avx512;
+  }
+#endif
+}
+
+// Returns the name of an instruction set level
+const char *cpu_level_name(uint32_t level) {
+  return level <= CPU_AVX512 ? level_names[level] : "unknown";
+}
+
+// Returns the level with the given name, or UINT32_MAX if the name isn't known
+uint32_t cpu_level_parse(const char *name) {
+  for (uint32_t i = 0; i <= CPU_AVX512; i += 1) {
+    if (strcmp(name, level_names[i]) == 0) {
+      return i;
+    }
+  }
+  return UINT32_MAX;
+}
@@ -0,0 +1,53 @@
+#ifndef __CPU_H__
+#define __CPU_H__
+
+#include "city.h"
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Instruction set levels, each one including the ones before it
+#define CPU_SCALAR 0
+#define CPU_SSE42  1
+#define CPU_AVX2   2
+#define CPU_AVX512 3
+
+// word_span may read up to CPU_SPAN_PAD bytes past the end of its string, so
+// buffers passed to it need that much slack after the terminating '\0'.
+#define CPU_SPAN_PAD 64
+
+typedef uint64_t (*hash64_fn)(const char *s, size_t len, uint64_t seed);
+
+typedef uint128 (*hash128_fn)(const char *s, size_t len, uint128 seed);
+
+typedef uint32_t (*span_fn)(const char *s);
+
+typedef void (*or_fn)(uint64_t *dst, const uint64_t *src, size_t n);
+
+// The kernels bound for the CPU the program runs on. level is the instruction
+// set they use, hash64 hashes words for the Bloom filter and hash table
+// (hash_crc32c from SSE4.2 on, CityHash below it, unless --hash picks another),
+// hash128 hashes whole messages, and word_span returns the length of the run
+// of word characters (letters, digits, ' and -) at the start of a string.
+// or_words ORs n words of src into dst (merging Bloom filters).
+typedef struct Kernels Kernels;
+
+struct Kernels {
+  uint32_t level;
+  hash64_fn hash64;
+  hash128_fn hash128;
+  span_fn word_span;
+  or_fn or_words;
+};
+
+extern Kernels kernels;
+
+uint32_t cpu_detect(void);
+
+void cpu_init(uint32_t max_level);
+
+const char *cpu_level_name(uint32_t level);
+
+uint32_t cpu_level_parse(const char *name);
+
+#endif
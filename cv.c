@@ -0,0 +1,105 @@
+#include "cv.h"
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+// Defines what members/fields the CounterVector structure has
+// length is the number of counters
+// vector holds the counters, packed 4 bits each (16 counters per uint64_t)
+typedef struct CounterVector CounterVector;
+
+struct CounterVector {
+  uint32_t length;
+  uint64_t *vector;
+};
+
+// The constructor for the CounterVector. Creates a new CounterVector and
+// returns a pointer to it if the memory was allocated succesfully. Else, return
+// NULL. Takes an uint32_t argument length and sets the number of counters to it
+CounterVector *cv_create(uint32_t length) {
+  // Allocates memory for the new CounterVector
+  CounterVector *cv = (CounterVector *)malloc(sizeof(CounterVector));
+  // If the memory was allocated, set the members of the CounterVector
+  if (cv != NULL) {
+    cv->length = length;
+    cv->vector = (uint64_t *)calloc(length / 16 + 1, sizeof(uint64_t));
+    if (cv->vector == NULL) {
+      free(cv);
+      cv = NULL;
+    }
+  }
+  // Returns the CounterVector
+  return cv;
+}
+
+// The destructor for a CounterVector. Frees the vector member, frees the
+// pointer to the counter vector, and set it to NULL
+void cv_delete(CounterVector **cv) {
+  if (*cv) {
+    free((*cv)->vector);
+    free(*cv);
+    *cv = NULL;
+  }
+}
+
+// Returns the number of counters in the CounterVector
+uint32_t cv_length(CounterVector *cv) { return cv->length; }
+
+// Returns the ith counter in a CounterVector (0-15)
+uint8_t cv_get(CounterVector *cv, uint32_t i) {
+  if (cv != NULL) {
+    uint64_t word = i / 16;        // Gets the word that the ith counter is in
+    uint64_t shift = (i % 16) * 4; // Gets the offset of the counter in the word
+    return (cv->vector[word] >> shift) & 0xF;
+  }
+  // If cv doesn't exist, return 0
+  return 0;
+}
+
+// Increments the ith counter. A counter that reached CV_MAX stays there, since
+// we no longer know how many keys share it (it becomes sticky).
+void cv_inc(CounterVector *cv, uint32_t i) {
+  if (cv != NULL && cv_get(cv, i) < CV_MAX) {
+    cv->vector[i / 16] += (1UL << ((i % 16) * 4));
+  }
+}
+
+// Decrements the ith counter. Counters at 0 or at the sticky CV_MAX are left
+// alone so that a remove can never cause a false negative.
+void cv_dec(CounterVector *cv, uint32_t i) {
+  if (cv != NULL) {
+    uint8_t v = cv_get(cv, i);
+    if (v > 0 && v < CV_MAX) {
+      cv->vector[i / 16] -= (1UL << ((i % 16) * 4));
+    }
+  }
+}
+
+// Adds every counter of src to the same counter of dst, stopping at the sticky
+// CV_MAX, as if the increments of src had been made to dst. Returns false
+// (and leaves dst alone) if their lengths differ.
+bool cv_add(CounterVector *dst, CounterVector *src) {
+  if (dst->length != src->length) {
+    return false;
+  }
+  for (uint32_t w = 0; w < dst->length / 16 + 1; w += 1) {
+    if (src->vector[w] == 0) {
+      continue; // Most words of a sparse filter are empty
+    }
+    uint64_t sum = 0;
+    for (uint32_t i = 0; i < 64; i += 4) {
+      uint64_t v = ((dst->vector[w] >> i) & 0xF) + ((src->vector[w] >> i) & 0xF);
+      sum |= (v < CV_MAX ? v : CV_MAX) << i;
+    }
+    dst->vector[w] = sum;
+  }
+  return true;
+}
+
+// Prints all counters of the CounterVector in hex
+void cv_print(CounterVector *cv) {
+  for (uint32_t i = 0; i < cv_length(cv); i += 1) {
+    printf("%x", cv_get(cv, i));
+  }
+  printf("\n");
+}
@@ -0,0 +1,27 @@
+#ifndef __CV_H__
+#define __CV_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define CV_MAX 15
+
+typedef struct CounterVector CounterVector;
+
+CounterVector *cv_create(uint32_t length);
+
+void cv_delete(CounterVector **cv);
+
+uint32_t cv_length(CounterVector *cv);
+
+void cv_inc(CounterVector *cv, uint32_t i);
+
+void cv_dec(CounterVector *cv, uint32_t i);
+
+uint8_t cv_get(CounterVector *cv, uint32_t i);
+
+bool cv_add(CounterVector *dst, CounterVector *src);
+
+void cv_print(CounterVector *cv);
+
+#endif
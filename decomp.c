@@ -0,0 +1,230 @@
+#include "decomp.h"
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#ifdef HAVE_ZLIB
+#include <zlib.h>
+#endif
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+#endif
+
+static const char *format_names[] = {"none", "gzip", "zstd"};
+
+// Defines what members/fields the Decoder has.
+// The compressed bytes are read from fd into in (n_in of them, the next at
+// pos). end is set once the input ended, and failed if it was corrupt or
+// couldn't be read. between is set while the decoder is between two gzip
+// members or zstd frames, where the input may end.
+typedef struct Decoder Decoder;
+
+struct Decoder {
+  int fd;
+  uint32_t format;
+  char *in;
+  uint64_t n_in;
+  uint64_t pos;
+  bool end;
+  bool failed;
+  bool between;
+#ifdef HAVE_ZLIB
+  z_stream z;
+#endif
+#ifdef HAVE_ZSTD
+  ZSTD_DStream *zs;
+#endif
+};
+
+// Returns the format of an input that starts with the n bytes of head (gzip
+// starts with 1f 8b, zstd with 28 b5 2f fd)
+uint32_t decomp_detect(const char *head, uint64_t n) {
+  const uint8_t *h = (const uint8_t *)head;
+  if (n >= 2 && h[0] == 0x1f && h[1] == 0x8b) {
+    return DECOMP_GZIP;
+  }
+  if (n >= 4 && h[0] == 0x28 && h[1] == 0xb5 && h[2] == 0x2f && h[3] == 0xfd) {
+    return DECOMP_ZSTD;
+  }
+  return DECOMP_NONE;
+}
+
+// Returns true if the program was built with the library that decompresses
+// format (or if there is nothing to decompress)
+bool decomp_supported(uint32_t format) {
+#ifdef HAVE_ZLIB
+  if (format == DECOMP_GZIP) {
+    return true;
+  }
+#endif
+#ifdef HAVE_ZSTD
+  if (format == DECOMP_ZSTD) {
+    return true;
+  }
+#endif
+  return format == DECOMP_NONE;
+}
+
+// Returns the name of a format
+const char *decomp_name(uint32_t format) {
+  return format <= DECOMP_ZSTD ? format_names[format] : "unknown";
+}
+
+// Reads the next compressed bytes into the buffer of the Decoder, once all of
+// it was used. Returns false if there are none left, which sets end (and
+// failed if fd couldn't be read).
+static bool refill(Decoder *d) {
+  if (d->pos < d->n_in) {
+    return true;
+  }
+  ssize_t r;
+  do {
+    r = read(d->fd, d->in, DECOMP_BUFFER);
+  } while (r < 0 && errno == EINTR);
+  if (r <= 0) {
+    d->end = true;
+    d->failed = r < 0;
+    return false;
+  }
+  d->n_in = r;
+  d->pos = 0;
+  return true;
+}
+
+// The constructor for a Decoder. Decompresses the input of format read from
+// fd, the first n_head bytes of which were already read into head (to detect
+// the format). Returns NULL if the format isn't supported or the memory
+// couldn't be allocated.
+Decoder *decoder_create(int fd, uint32_t format, const char *head,
+                        uint64_t n_head) {
+  if (format == DECOMP_NONE || !decomp_supported(format) ||
+      n_head > DECOMP_BUFFER) {
+    return NULL;
+  }
+  Decoder *d = (Decoder *)calloc(1, sizeof(Decoder));
+  if (d == NULL) {
+    return NULL;
+  }
+  d->fd = fd;
+  d->format = format;
+  d->in = (char *)malloc(DECOMP_BUFFER);
+  bool ok = d->in != NULL;
+  if (ok) {
+    memcpy(d->in, head, n_head);
+    d->n_in = n_head;
+  }
+#ifdef HAVE_ZLIB
+  // 32 lets zlib read the gzip header
+  if (ok && format == DECOMP_GZIP) {
+    ok = inflateInit2(&d->z, 15 + 32) == Z_OK;
+  }
+#endif
+#ifdef HAVE_ZSTD
+  if (ok && format == DECOMP_ZSTD) {
+    d->zs = ZSTD_createDStream();
+    ok = d->zs != NULL && !ZSTD_isError(ZSTD_initDStream(d->zs));
+  }
+#endif
+  if (!ok) {
+    d->format = DECOMP_NONE; // Nothing to end in decoder_delete
+    decoder_delete(&d);
+  }
+  return d;
+}
+
+// The destructor for a Decoder. fd isn't closed.
+void decoder_delete(Decoder **d) {
+  if (*d) {
+#ifdef HAVE_ZLIB
+    if ((*d)->format == DECOMP_GZIP) {
+      inflateEnd(&(*d)->z);
+    }
+#endif
+#ifdef HAVE_ZSTD
+    if ((*d)->format == DECOMP_ZSTD) {
+      ZSTD_freeDStream((*d)->zs);
+    }
+#endif
+    free((*d)->in);
+    free(*d);
+    *d = NULL;
+  }
+}
+
+#ifdef HAVE_ZLIB
+// Inflates gzip into buf (n bytes). A file may hold several gzip members one
+// after the other, like zcat reads them; anything after the last one that
+// isn't a gzip member is ignored, like gzip does.
+static uint64_t read_gzip(Decoder *d, char *buf, uint64_t n) {
+  z_stream *z = &d->z;
+  z->next_out = (Bytef *)buf;
+  z->avail_out = n;
+  while (z->avail_out > 0 && !d->end) {
+    if (!refill(d)) {
+      d->failed = d->failed || !d->between; // It ended in the middle
+      break;
+    }
+    z->next_in = (Bytef *)d->in + d->pos;
+    z->avail_in = d->n_in - d->pos;
+    int ret = inflate(z, Z_NO_FLUSH);
+    d->pos = d->n_in - z->avail_in;
+    if (ret == Z_STREAM_END) {
+      d->between = true;
+      inflateReset(z);
+    } else if (ret == Z_OK || ret == Z_BUF_ERROR) {
+      d->between = false;
+    } else {
+      d->end = true;
+      d->failed = !d->between; // Else, it is trailing garbage
+    }
+  }
+  return n - z->avail_out;
+}
+#endif
+
+#ifdef HAVE_ZSTD
+// Decompresses zstd into buf (n bytes). A file may hold several frames.
+static uint64_t read_zstd(Decoder *d, char *buf, uint64_t n) {
+  ZSTD_outBuffer out = {buf, n, 0};
+  while (out.pos < out.size && !d->end) {
+    if (!refill(d)) {
+      d->failed = d->failed || !d->between; // It ended in the middle
+      break;
+    }
+    ZSTD_inBuffer in = {d->in, d->n_in, d->pos};
+    size_t ret = ZSTD_decompressStream(d->zs, &out, &in);
+    d->pos = in.pos;
+    if (ZSTD_isError(ret)) {
+      d->end = d->failed = true;
+    } else {
+      d->between = ret == 0; // 0 once a frame is complete
+    }
+  }
+  return out.pos;
+}
+#endif
+
+// Decompresses the next n bytes of the input into buf, like read would read
+// them from a file. Returns the number of bytes decompressed, which is less
+// than n only at the end of the input (or if it is corrupt, which
+// decoder_failed then tells).
+uint64_t decoder_read(Decoder *d, char *buf, uint64_t n) {
+#ifdef HAVE_ZLIB
+  if (d->format == DECOMP_GZIP) {
+    return read_gzip(d, buf, n);
+  }
+#endif
+#ifdef HAVE_ZSTD
+  if (d->format == DECOMP_ZSTD) {
+    return read_zstd(d, buf, n);
+  }
+#endif
+  (void)buf;
+  (void)n;
+  return 0;
+}
+
+// Returns true if the input of the Decoder was corrupt, cut short or
+// couldn't be read
+bool decoder_failed(Decoder *d) { return d->failed; }
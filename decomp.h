@@ -0,0 +1,34 @@
+#ifndef __DECOMP_H__
+#define __DECOMP_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Formats of the input, told apart by their first bytes
+#define DECOMP_NONE 0
+#define DECOMP_GZIP 1
+#define DECOMP_ZSTD 2
+
+// Number of bytes decomp_detect needs to tell the formats apart
+#define DECOMP_MAGIC 4
+// Size of the buffer of compressed bytes of a Decoder
+#define DECOMP_BUFFER (1 << 17)
+
+typedef struct Decoder Decoder;
+
+uint32_t decomp_detect(const char *head, uint64_t n);
+
+bool decomp_supported(uint32_t format);
+
+const char *decomp_name(uint32_t format);
+
+Decoder *decoder_create(int fd, uint32_t format, const char *head,
+                        uint64_t n_head);
+
+void decoder_delete(Decoder **d);
+
+uint64_t decoder_read(Decoder *d, char *buf, uint64_t n);
+
+bool decoder_failed(Decoder *d);
+
+#endif
@@ -0,0 +1,401 @@
+#include "dh.h"
+#include "city.h"
+#include "dict.h"
+#include "norm.h"
+#include "parser.h"
+#include "seed.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define DH_MAGIC "BHDISK2"
+// new_len of the entry of a badspeak word, which has no newspeak
+#define DH_NONE 0xFFFF
+
+// Defines the header of a hash file, which fills its first page. The Bloom
+// filter (bloom_bits bits) starts at the second page, and the n_buckets
+// buckets at bucket_offset, one page each, so a lookup that gets past the
+// Bloom filter reads one page (two if the bucket overflowed). node_bytes is
+// how much an arena needs to copy every word (with its newspeak) into Nodes.
+// norm is the normalization the words were read with (the flags of the
+// Normalizer). The numbers are in the byte order of the machine that built
+// the file.
+typedef struct Header Header;
+
+struct Header {
+  char magic[8];
+  uint64_t norm;
+  uint64_t n_keys;
+  uint64_t n_buckets;
+  uint64_t bloom_bits;
+  uint64_t salt;
+  uint64_t bucket_offset;
+  uint64_t node_bytes;
+  uint64_t size;
+};
+
+// Defines the start of a bucket. used is the number of bytes of entries that
+// follow it and count the number of entries. overflow is set once an entry
+// that hashes to this bucket didn't fit and went to the next one.
+typedef struct Bucket Bucket;
+
+struct Bucket {
+  uint32_t used;
+  uint16_t count;
+  uint16_t overflow;
+};
+
+// Defines an entry of a bucket, which is followed by the len bytes of its
+// oldspeak and the new_len bytes of its newspeak (none if new_len is DH_NONE).
+// fp is the high half of the hash of the oldspeak. Entries are packed, so
+// they are copied out rather than read in place.
+typedef struct Entry Entry;
+
+struct Entry {
+  uint32_t fp;
+  uint16_t len;
+  uint16_t new_len;
+};
+
+// Bytes of a bucket that entries can use
+#define DH_ROOM (DH_PAGE - sizeof(Bucket))
+// Buckets are sized to be about 3/4 full, so few of them overflow
+#define DH_FILL_NUM 3
+#define DH_FILL_DEN 4
+
+// Defines what members/fields the DiskHash has.
+// header points at the mapping of the whole file, and buckets at its first
+// bucket. bloom is a copy of the Bloom filter in memory, so that misses never
+// touch the disk. fd is kept to drop the file from the page cache.
+struct DiskHash {
+  Header *header;
+  uint8_t *buckets;
+  uint64_t *bloom;
+  int fd;
+};
+
+// Returns the bucket i of the hash file
+static Bucket *bucket(DiskHash *dh, uint64_t i) {
+  return (Bucket *)(dh->buckets + i * DH_PAGE);
+}
+
+// Returns the bit of the Bloom filter probed by hash i of the key hashed to h.
+// The DH_BLOOM_HASHES hashes are made from the two halves of h.
+static uint64_t bloom_bit(DiskHash *dh, uint64_t h, uint32_t i) {
+  uint64_t a = (uint32_t)h;
+  uint64_t b = (h >> 32) | 1;
+  return (a + i * b) % dh->header->bloom_bits;
+}
+
+// Returns true if the Bloom filter may hold the key hashed to h
+static bool bloom_test(DiskHash *dh, uint64_t h) {
+  for (uint32_t i = 0; i < DH_BLOOM_HASHES; i += 1) {
+    uint64_t bit = bloom_bit(dh, h, i);
+    if ((dh->bloom[bit / 64] & (1UL << (bit % 64))) == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Looks for the entry of word (of length len, hashed to h) in its bucket and
+// the ones it overflowed to. Copies the entry into e and returns a pointer to
+// its oldspeak, or NULL if word isn't there. Adds the number of buckets read
+// to pages. The entries of a bucket aren't trusted: the walk stops at the end
+// of its page, and an entry whose newspeak is longer than a word can be
+// isn't a match, so a corrupt file can't make a lookup read or copy too much.
+static uint8_t *find(DiskHash *dh, char *word, uint32_t len, uint64_t h,
+                     Entry *e, uint64_t *pages) {
+  uint64_t n = dh->header->n_buckets;
+  uint64_t i = h % n;
+  for (uint64_t tried = 0; tried < n; tried += 1) {
+    Bucket *b = bucket(dh, i);
+    *pages += 1;
+    uint8_t *p = (uint8_t *)(b + 1);
+    uint8_t *end = (uint8_t *)b + DH_PAGE;
+    for (uint32_t k = 0; k < b->count && p + sizeof(Entry) <= end; k += 1) {
+      memcpy(e, p, sizeof(Entry));
+      uint8_t *key = p + sizeof(Entry);
+      uint32_t new_len = e->new_len == DH_NONE ? 0 : e->new_len;
+      if (new_len > MAX_PARSER_LINE_LENGTH ||
+          e->len + new_len > (uint64_t)(end - key)) {
+        return NULL;
+      }
+      if (e->fp == (uint32_t)(h >> 32) && e->len == len &&
+          memcmp(key, word, len) == 0) {
+        return key;
+      }
+      p = key + e->len + new_len;
+    }
+    if (!b->overflow) {
+      return NULL;
+    }
+    i = (i + 1) % n;
+  }
+  return NULL;
+}
+
+// Calls fn with arg on every badspeak word (whose newspeak is NULL), then on
+// every oldspeak-newspeak pair. Empty words are skipped, since they are never
+// looked up. Returns false if a file can't be opened or fn returned false.
+static bool each_word(char *badspeak, char *newspeak,
+                      bool (*fn)(void *arg, char *old, char *new), void *arg) {
+  char *files[2] = {badspeak, newspeak};
+  char oldword[MAX_PARSER_LINE_LENGTH + 1] = "";
+  char newword[MAX_PARSER_LINE_LENGTH + 1] = "";
+  uint32_t len = 0;
+  uint32_t new_len = 0;
+  bool ok = true;
+  for (uint32_t pairs = 0; ok && pairs < 2; pairs += 1) {
+    FILE *f = fopen(files[pairs], "r");
+    if (f == NULL) {
+      return false;
+    }
+    Parser *p = parser_create(f);
+    while (ok && next_word(p, oldword, &len) &&
+           (!pairs || next_newspeak(p, newword, &new_len))) {
+      if (oldword[0] != '\0') {
+        ok = fn(arg, oldword, pairs ? newword : NULL);
+      }
+    }
+    parser_delete(&p);
+  }
+  return ok;
+}
+
+// Adds a word to the number of keys and bytes of entries (in a Header) the
+// hash file will need at most
+static bool count_word(void *arg, char *old, char *new) {
+  Header *h = (Header *)arg;
+  uint64_t len = strlen(old);
+  uint64_t new_len = new ? strlen(new) : 0;
+  h->n_keys += 1;
+  h->size += sizeof(Entry) + len + new_len;
+  h->node_bytes += dict_word_bytes(len, new_len);
+  return true;
+}
+
+// Inserts a word into the hash file being built (a DiskHash), unless it is
+// already there: the first time a word appears is the one that counts, like
+// for the HashTable. It goes to the first bucket from its own that has room
+// for it, and the buckets it skipped are marked as overflowed. Returns false
+// if no bucket has room.
+static bool insert_word(void *arg, char *old, char *new) {
+  DiskHash *dh = (DiskHash *)arg;
+  Header *header = dh->header;
+  uint32_t len = strlen(old);
+  uint32_t new_len = new ? strlen(new) : 0;
+  uint64_t h = CityHash64WithSeed(old, len, header->salt);
+  Entry e;
+  uint64_t pages = 0;
+  if (find(dh, old, len, h, &e, &pages) != NULL) {
+    return true;
+  }
+  uint32_t size = sizeof(Entry) + len + new_len;
+  uint64_t i = h % header->n_buckets;
+  uint64_t tried = 0;
+  while (bucket(dh, i)->used + size > DH_ROOM) {
+    bucket(dh, i)->overflow = 1;
+    i = (i + 1) % header->n_buckets;
+    tried += 1;
+    if (tried == header->n_buckets) {
+      return false;
+    }
+  }
+  Bucket *b = bucket(dh, i);
+  uint8_t *p = (uint8_t *)(b + 1) + b->used;
+  e.fp = h >> 32;
+  e.len = len;
+  e.new_len = new ? new_len : DH_NONE;
+  memcpy(p, &e, sizeof(Entry));
+  memcpy(p + sizeof(Entry), old, len);
+  memcpy(p + sizeof(Entry) + len, new ? new : "", new_len);
+  b->used += size;
+  b->count += 1;
+  for (uint32_t k = 0; k < DH_BLOOM_HASHES; k += 1) {
+    uint64_t bit = bloom_bit(dh, h, k);
+    dh->bloom[bit / 64] |= 1UL << (bit % 64);
+  }
+  header->n_keys += 1;
+  return true;
+}
+
+// Builds the hash file at path from the dictionary files. The words are read
+// twice: once to size the file, and once to write them straight into it
+// through a shared mapping, so the dictionary never has to fit in memory (the
+// kernel writes the pages back as it needs to). Returns false if a file can't
+// be read or written.
+bool dh_build(char *badspeak, char *newspeak, char *path) {
+  Header sizing;
+  memset(&sizing, 0, sizeof(Header));
+  if (!each_word(badspeak, newspeak, count_word, &sizing)) {
+    return false;
+  }
+  Header h;
+  memset(&h, 0, sizeof(Header));
+  memcpy(h.magic, DH_MAGIC, sizeof(h.magic));
+  h.norm = normalizer.flags;
+  h.n_buckets =
+      sizing.size * DH_FILL_DEN / (DH_ROOM * DH_FILL_NUM) + 1;
+  h.bloom_bits = (sizing.n_keys * DH_BLOOM_BITS + 63) / 64 * 64;
+  h.bloom_bits = h.bloom_bits ? h.bloom_bits : 64;
+  h.salt = seed_next();
+  h.bucket_offset = DH_PAGE + (h.bloom_bits / 8 + DH_PAGE - 1) / DH_PAGE *
+                                  DH_PAGE;
+  h.node_bytes = sizing.node_bytes;
+  h.size = h.bucket_offset + h.n_buckets * DH_PAGE;
+
+  int fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) {
+    return false;
+  }
+  void *map = MAP_FAILED;
+  if (ftruncate(fd, h.size) == 0) {
+    map = mmap(NULL, h.size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  }
+  close(fd);
+  if (map == MAP_FAILED) {
+    return false;
+  }
+  // The file is all zeros: empty buckets and an empty Bloom filter
+  DiskHash dh;
+  dh.header = (Header *)map;
+  memcpy(dh.header, &h, sizeof(Header));
+  dh.bloom = (uint64_t *)((uint8_t *)map + DH_PAGE);
+  dh.buckets = (uint8_t *)map + h.bucket_offset;
+  dh.fd = -1;
+  bool ok = each_word(badspeak, newspeak, insert_word, &dh);
+  ok = msync(map, h.size, MS_SYNC) == 0 && ok;
+  munmap(map, h.size);
+  return ok;
+}
+
+// Returns true if the size and layout of the hash file with header h (of size
+// bytes) make sense, so that no lookup can read past its end, and its words
+// were normalized like the text will be
+static bool valid(Header *h, uint64_t size) {
+  return size >= DH_PAGE && memcmp(h->magic, DH_MAGIC, sizeof(h->magic)) == 0 &&
+         h->norm == normalizer.flags && h->size == size &&
+         h->n_buckets > 0 && h->bloom_bits > 0 &&
+         h->bloom_bits % 64 == 0 &&
+         h->bucket_offset >= DH_PAGE + h->bloom_bits / 8 &&
+         h->bucket_offset % DH_PAGE == 0 &&
+         h->bucket_offset + h->n_buckets * DH_PAGE == h->size;
+}
+
+// The constructor for the DiskHash. Maps the hash file at path (written by
+// dh_build) read-only and copies its Bloom filter into memory. The buckets
+// are left on disk: the kernel is told the lookups are random, so it reads
+// only the page that is touched instead of reading ahead. Returns NULL if the
+// file can't be mapped or isn't a hash file.
+DiskHash *dh_open(char *path) {
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    return NULL;
+  }
+  struct stat st;
+  void *map = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && st.st_size >= DH_PAGE) {
+    map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  }
+  DiskHash *dh = NULL;
+  if (map != MAP_FAILED && valid((Header *)map, st.st_size)) {
+    dh = (DiskHash *)malloc(sizeof(DiskHash));
+  }
+  if (dh) {
+    dh->header = (Header *)map;
+    dh->buckets = (uint8_t *)map + dh->header->bucket_offset;
+    dh->fd = fd;
+    uint64_t bloom_bytes = dh->header->bloom_bits / 8;
+    uint8_t *bloom = (uint8_t *)map + DH_PAGE;
+    dh->bloom = (uint64_t *)malloc(bloom_bytes);
+    if (dh->bloom == NULL) {
+      free(dh);
+      dh = NULL;
+    } else {
+      // The Bloom filter is read in one sweep, and its pages of the mapping
+      // are no longer needed once it is copied
+      madvise(bloom, bloom_bytes, MADV_SEQUENTIAL);
+      madvise(bloom, bloom_bytes, MADV_WILLNEED);
+      memcpy(dh->bloom, bloom, bloom_bytes);
+      madvise(bloom, bloom_bytes, MADV_DONTNEED);
+      madvise(dh->buckets, dh->header->n_buckets * DH_PAGE, MADV_RANDOM);
+    }
+  }
+  if (dh == NULL) {
+    if (map != MAP_FAILED) {
+      munmap(map, st.st_size);
+    }
+    close(fd);
+  }
+  return dh;
+}
+
+// The destructor for a DiskHash. Unmaps the file and frees the Bloom filter.
+void dh_delete(DiskHash **dh) {
+  if (*dh) {
+    munmap((*dh)->header, (*dh)->header->size);
+    close((*dh)->fd);
+    free((*dh)->bloom);
+    free(*dh);
+    *dh = NULL;
+  }
+}
+
+// Looks up word (of length len) in the hash file. Returns DH_MISS if it isn't
+// there, DH_BADSPEAK if it is badspeak, or DH_NEWSPEAK if it has a newspeak,
+// which is then copied into newspeak (MAX_PARSER_LINE_LENGTH + 1 bytes).
+// Misses are mostly answered by the Bloom filter without reading the disk.
+// The file is only read and the stats are added to c, so many threads can
+// look words up at once.
+int dh_lookup(DiskHash *dh, char *word, uint32_t len, char *newspeak,
+              Counters *c) {
+  uint64_t h = CityHash64WithSeed(word, len, dh->header->salt);
+  if (!bloom_test(dh, h)) {
+    c->disk_filtered += 1;
+    c->disk_misses += 1;
+    return DH_MISS;
+  }
+  Entry e;
+  uint8_t *key = find(dh, word, len, h, &e, &c->disk_pages);
+  if (key == NULL) {
+    c->disk_misses += 1;
+    return DH_MISS;
+  }
+  c->disk_hits += 1;
+  if (e.new_len == DH_NONE) {
+    return DH_BADSPEAK;
+  }
+  memcpy(newspeak, key + e.len, e.new_len);
+  newspeak[e.new_len] = '\0';
+  return DH_NEWSPEAK;
+}
+
+// Drops the buckets of the hash file from memory and from the page cache, so
+// the next lookups read them from the disk again (used by the benchmark)
+void dh_evict(DiskHash *dh) {
+  uint64_t bytes = dh->header->n_buckets * DH_PAGE;
+  madvise(dh->buckets, bytes, MADV_DONTNEED);
+  posix_fadvise(dh->fd, dh->header->bucket_offset, bytes,
+                POSIX_FADV_DONTNEED);
+}
+
+// Returns the number of words in the hash file
+uint64_t dh_keys(DiskHash *dh) { return dh->header->n_keys; }
+
+// Returns the number of buckets (pages) of the hash file
+uint64_t dh_buckets(DiskHash *dh) { return dh->header->n_buckets; }
+
+// Returns the size of the hash file in bytes
+uint64_t dh_size(DiskHash *dh) { return dh->header->size; }
+
+// Returns the size of the Bloom filter kept in memory in bytes
+uint64_t dh_bloom_bytes(DiskHash *dh) { return dh->header->bloom_bits / 8; }
+
+// Returns the number of bytes the words of the hash file would take in an
+// arena, like the HashTable
+uint64_t dh_node_bytes(DiskHash *dh) { return dh->header->node_bytes; }
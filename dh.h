@@ -0,0 +1,44 @@
+#ifndef __DH_H__
+#define __DH_H__
+
+#include "stats.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Size of a bucket of the hash file (one page)
+#define DH_PAGE 4096
+// Bits and hashes per key of the Bloom filter in front of the buckets (about
+// 1% false positives)
+#define DH_BLOOM_BITS   10
+#define DH_BLOOM_HASHES 7
+
+// Results of dh_lookup
+#define DH_MISS      -1
+#define DH_BADSPEAK  0
+#define DH_NEWSPEAK  1
+
+typedef struct DiskHash DiskHash;
+
+bool dh_build(char *badspeak, char *newspeak, char *path);
+
+DiskHash *dh_open(char *path);
+
+void dh_delete(DiskHash **dh);
+
+int dh_lookup(DiskHash *dh, char *word, uint32_t len, char *newspeak,
+              Counters *c);
+
+void dh_evict(DiskHash *dh);
+
+uint64_t dh_keys(DiskHash *dh);
+
+uint64_t dh_buckets(DiskHash *dh);
+
+uint64_t dh_size(DiskHash *dh);
+
+uint64_t dh_bloom_bytes(DiskHash *dh);
+
+uint64_t dh_node_bytes(DiskHash *dh);
+
+#endif
@@ -0,0 +1,724 @@
+#include "dict.h"
+#include "bf.h"
+#include "ht.h"
+#include "parser.h"
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Defines what members/fields the Dictionary has.
+// A Dictionary is one generation of the badspeak/newspeak word lists: the
+// BloomFilter and HashTable built from them, plus everything needed to build
+// the next generation (sizes, options and the files it was loaded from).
+// id is different for every Dictionary ever created in the process.
+// If trie is set, the words are looked up in it instead, and the BloomFilter
+// and HashTable stay empty. shm is the name of the shared dictionary the trie
+// was attached from (NULL if none), and generation its generation there.
+// Likewise, if disk is set the words are looked up in that hash file.
+// With dict_load_fast, the HashTable is filled by the builder thread from the
+// files bad and new; ready is set once it is complete, and until then reserve
+// is an upper bound of the bytes its words will take. dead is an upper bound
+// of the bytes of the words dict_apply removed from the HashTable.
+typedef struct Dictionary Dictionary;
+
+struct Dictionary {
+  uint64_t id;
+  BloomFilter *bf;
+  HashTable *ht;
+  Trie *trie;
+  DiskHash *disk;
+  char *shm;
+  uint64_t generation;
+  uint32_t ht_size;
+  uint32_t bf_size;
+  bool mtf;
+  bool counting;
+  char *badspeak;
+  char *newspeak;
+  pthread_t builder;
+  bool building;
+  _Atomic bool ready;
+  FILE *bad;
+  FILE *new;
+  uint64_t reserve;
+  uint64_t dead;
+};
+
+static _Atomic uint64_t next_id = 1; // The id of the next Dictionary
+
+// The constructor for the Dictionary. Creates an empty BloomFilter and
+// HashTable with the given sizes and options. Returns NULL if either couldn't
+// be allocated.
+Dictionary *dict_create(uint32_t ht_size, uint32_t bf_size, bool mtf,
+                        bool counting) {
+  Dictionary *d = (Dictionary *)malloc(sizeof(Dictionary));
+  if (d) {
+    d->id = atomic_fetch_add(&next_id, 1);
+    d->ht_size = ht_size;
+    d->bf_size = bf_size;
+    d->mtf = mtf;
+    d->counting = counting;
+    d->badspeak = d->newspeak = NULL;
+    d->trie = NULL;
+    d->disk = NULL;
+    d->shm = NULL;
+    d->generation = 0;
+    d->building = false;
+    d->ready = true;
+    d->bad = d->new = NULL;
+    d->reserve = 0;
+    d->dead = 0;
+#ifdef STATIC_DICT
+    // banhammer-static only looks words up in a trie or a hash file, so it
+    // never fills a BloomFilter or HashTable
+    d->bf = NULL;
+    d->ht = NULL;
+#else
+    d->bf = bf_create(bf_size, counting);
+    d->ht = ht_create(ht_size, mtf);
+    if (d->bf == NULL || d->ht == NULL) {
+      dict_delete(&d);
+    }
+#endif
+  }
+  return d;
+}
+
+// The destructor for a Dictionary. Frees the BloomFilter, HashTable, Trie and
+// DiskHash (once the HashTable is built, if it still was).
+void dict_delete(Dictionary **d) {
+  if (*d) {
+    dict_wait(*d);
+    bf_delete(&(*d)->bf);
+    ht_delete(&(*d)->ht);
+    trie_delete(&(*d)->trie);
+    dh_delete(&(*d)->disk);
+    free(*d);
+    *d = NULL;
+  }
+}
+
+// Returns the most bytes the arena of a HashTable (or of the offense lists)
+// can take for a word of length len whose newspeak has length new_len
+uint64_t dict_word_bytes(uint64_t len, uint64_t new_len) {
+  return ((sizeof(Node) + 15) & ~15u) + ((len + 16) & ~15u) +
+         ((new_len + 16) & ~15u);
+}
+
+// Reads the badspeak words (or, if pairs is set, the oldspeak-newspeak pairs)
+// from the file f, which is closed, and inserts them to bf and ht (either can
+// be NULL). Returns the most bytes the words can take in an arena.
+static uint64_t insert_file(FILE *f, bool pairs, BloomFilter *bf,
+                            HashTable *ht) {
+  uint64_t bytes = 0;
+  Parser *p = parser_create(f);
+  char oldspeak[MAX_PARSER_LINE_LENGTH + 1] = "";
+  char newword[MAX_PARSER_LINE_LENGTH + 1] = "";
+  uint32_t len = 0;
+  uint32_t new_len = 0;
+  while (next_word(p, oldspeak, &len) &&
+         (!pairs || next_newspeak(p, newword, &new_len))) {
+    char *newspeak = pairs ? newword : NULL;
+    // A word that is already in ht isn't counted in bf twice, so that a
+    // counting BloomFilter can have it removed again
+    bool added = ht == NULL || ht_insert(ht, oldspeak, newspeak);
+    if (bf && added) {
+      bf_insert(bf, oldspeak);
+    }
+    bytes += dict_word_bytes(len, new_len);
+  }
+  parser_delete(&p);
+  return bytes;
+}
+
+// Reads the badspeak words and the oldspeak-newspeak pairs from the files bad
+// and new, and inserts them to the BloomFilter, the HashTable or both. Both
+// files are closed.
+static void insert_words(Dictionary *d, FILE *bad, FILE *new, bool bf,
+                         bool ht) {
+  uint64_t bytes = insert_file(bad, false, bf ? d->bf : NULL,
+                               ht ? d->ht : NULL);
+  bytes += insert_file(new, true, bf ? d->bf : NULL, ht ? d->ht : NULL);
+  if (bf) {
+    d->reserve += bytes; // The builder thread of dict_load_fast doesn't
+  }
+}
+
+// Opens the badspeak and newspeak files of the Dictionary. Returns false
+// (with neither open) if one can't be opened.
+static bool open_words(Dictionary *d, FILE **bad, FILE **new) {
+  *bad = fopen(d->badspeak, "r");
+  *new = fopen(d->newspeak, "r");
+  if (*bad == NULL || *new == NULL) {
+    if (*bad) {
+      fclose(*bad);
+    }
+    if (*new) {
+      fclose(*new);
+    }
+    return false;
+  }
+  return true;
+}
+
+// Reads in the badspeak words and the oldspeak-newspeak pairs and inserts them
+// to the BloomFilter & HashTable. The file names are remembered so that
+// dict_rebuild can read them again. Returns false if a file can't be opened.
+bool dict_load(Dictionary *d, char *badspeak, char *newspeak) {
+  d->badspeak = badspeak;
+  d->newspeak = newspeak;
+  FILE *bad = NULL;
+  FILE *new = NULL;
+  if (!open_words(d, &bad, &new)) {
+    return false;
+  }
+  insert_words(d, bad, new, true, true);
+  return true;
+}
+
+// The builder thread. Fills the HashTable from the files opened by
+// dict_load_fast, then marks it ready.
+static void *build_ht(void *arg) {
+  Dictionary *d = (Dictionary *)arg;
+  insert_words(d, d->bad, d->new, false, true);
+  d->bad = d->new = NULL;
+  atomic_store_explicit(&d->ready, true, memory_order_release);
+  return NULL;
+}
+
+// Like dict_load, but only the BloomFilter is built before it returns. A word
+// is only looked up in the HashTable when the BloomFilter says it may be in
+// it, so the scan can start while a thread fills the HashTable; dict_ready
+// tells when it is done and dict_wait waits for it. Each file is opened twice
+// up front, so the builder can't fail half way. Returns false if a file can't
+// be opened.
+bool dict_load_fast(Dictionary *d, char *badspeak, char *newspeak) {
+  d->badspeak = badspeak;
+  d->newspeak = newspeak;
+  FILE *bad = NULL;
+  FILE *new = NULL;
+  if (!open_words(d, &bad, &new)) {
+    return false;
+  }
+  if (!open_words(d, &d->bad, &d->new)) {
+    fclose(bad);
+    fclose(new);
+    return false;
+  }
+  insert_words(d, bad, new, true, false);
+  d->ready = false;
+  d->building = pthread_create(&d->builder, NULL, build_ht, d) == 0;
+  if (!d->building) {
+    build_ht(d); // Without a thread, it is built right away
+  }
+  return true;
+}
+
+// Reads all of the file at path into memory. Sets len to its length. Returns
+// NULL if it can't be read.
+static char *read_file(char *path, uint64_t *len) {
+  FILE *f = fopen(path, "r");
+  if (f == NULL) {
+    return NULL;
+  }
+  char *text = NULL;
+  long size = -1;
+  if (fseek(f, 0, SEEK_END) == 0 && (size = ftell(f)) >= 0 &&
+      fseek(f, 0, SEEK_SET) == 0) {
+    text = (char *)malloc(size + 1);
+  }
+  if (text && fread(text, 1, size, f) != (size_t)size) {
+    free(text);
+    text = NULL;
+  }
+  fclose(f);
+  *len = size;
+  return text;
+}
+
+// Returns the offset of the first line of text that starts at or after at
+// (len if there is none), so that slices of the text hold whole lines
+static uint64_t line_start(char *text, uint64_t len, uint64_t at) {
+  while (at > 0 && at < len && text[at - 1] != '\n') {
+    at += 1;
+  }
+  return at < len ? at : len;
+}
+
+// Defines what one thread of dict_load_parallel works on.
+// bf is its BloomFilter and ht its parts of the HashTable: the one of its
+// slice of the badspeak file, then the one of its slice of the newspeak file.
+// text and len are those slices. from and to are the lists of the HashTable
+// it merges, and moved the number of nodes moved from each part of builders
+// (all the n of them), badspeak parts first.
+typedef struct Builder Builder;
+
+struct Builder {
+  Dictionary *d;
+  BloomFilter *bf;
+  HashTable *ht[2];
+  char *text[2];
+  uint64_t len[2];
+  uint32_t from;
+  uint32_t to;
+  Builder *builders;
+  uint32_t n;
+  uint64_t *moved;
+};
+
+// Fills the BloomFilter and the parts of the HashTable of a builder from its
+// slices. A slice is read with next_word like a whole file would be.
+static void *build_part(void *arg) {
+  Builder *b = (Builder *)arg;
+  for (uint32_t f = 0; f < 2; f += 1) {
+    FILE *slice = b->len[f] ? fmemopen(b->text[f], b->len[f], "r") : NULL;
+    if (slice) {
+      insert_file(slice, f == 1, b->bf, b->ht[f]);
+    }
+  }
+  return NULL;
+}
+
+// Merges the lists from to to - 1 of every part into the HashTable of the
+// Dictionary, in the order of the files: the badspeak slices first, then the
+// newspeak ones, so the first time a word appears is still the one that
+// counts.
+static void *merge_part(void *arg) {
+  Builder *b = (Builder *)arg;
+  for (uint32_t f = 0; f < 2; f += 1) {
+    for (uint32_t i = 0; i < b->n; i += 1) {
+      b->moved[f * b->n + i] =
+          ht_merge(b->d->ht, b->builders[i].ht[f], b->from, b->to);
+    }
+  }
+  return NULL;
+}
+
+// Runs fn on every builder, each in a thread of its own (or in the calling
+// thread, if one can't be started)
+static void run_builders(Builder *b, uint32_t n, void *(*fn)(void *)) {
+  pthread_t *threads = (pthread_t *)malloc(n * sizeof(pthread_t));
+  bool *started = (bool *)calloc(n, sizeof(bool));
+  for (uint32_t i = 1; i < n; i += 1) {
+    started[i] = threads && started &&
+                 pthread_create(&threads[i], NULL, fn, &b[i]) == 0;
+  }
+  fn(&b[0]);
+  for (uint32_t i = 1; i < n; i += 1) {
+    if (started && started[i]) {
+      pthread_join(threads[i], NULL);
+    } else {
+      fn(&b[i]);
+    }
+  }
+  free(threads);
+  free(started);
+}
+
+// Like dict_load, but the dictionary is built by n threads. Both files are
+// split in n slices of whole lines, and each thread inserts its slices into a
+// BloomFilter and parts of the HashTable of its own (with the same salts).
+// Then each thread merges a range of the lists of every part into the
+// HashTable, which needs no lock since the ranges don't overlap, and the
+// BloomFilters are ORed together. The words, their newspeak and the Bloom
+// filter are the same as dict_load's. Long chains are only checked for once
+// the parts are merged, instead of after each insert, so if the table is
+// crowded enough to be rehashed its salt (and the chains) can differ from
+// dict_load's. Returns false if a file can't be read or the memory couldn't
+// be allocated.
+bool dict_load_parallel(Dictionary *d, char *badspeak, char *newspeak,
+                        uint32_t n) {
+  if (n <= 1) {
+    return dict_load(d, badspeak, newspeak);
+  }
+  d->badspeak = badspeak;
+  d->newspeak = newspeak;
+  char *text[2];
+  uint64_t len[2];
+  text[0] = read_file(badspeak, &len[0]);
+  text[1] = read_file(newspeak, &len[1]);
+  Builder *b = (Builder *)calloc(n, sizeof(Builder));
+  uint64_t *moved = (uint64_t *)calloc(2 * n * n, sizeof(uint64_t));
+  bool ok = text[0] && text[1] && b && moved;
+  for (uint32_t i = 0; ok && i < n; i += 1) {
+    b[i].d = d;
+    b[i].bf = i == 0 ? d->bf : bf_create_like(d->bf);
+    b[i].ht[0] = ht_create_like(d->ht);
+    b[i].ht[1] = ht_create_like(d->ht);
+    for (uint32_t f = 0; f < 2; f += 1) {
+      uint64_t start = line_start(text[f], len[f], len[f] * i / n);
+      uint64_t end = line_start(text[f], len[f], len[f] * (i + 1) / n);
+      b[i].text[f] = text[f] + start;
+      b[i].len[f] = end - start;
+    }
+    b[i].from = (uint64_t)ht_size(d->ht) * i / n;
+    b[i].to = (uint64_t)ht_size(d->ht) * (i + 1) / n;
+    b[i].builders = b;
+    b[i].n = n;
+    b[i].moved = moved + 2 * n * i;
+    ok = b[i].bf && b[i].ht[0] && b[i].ht[1];
+  }
+  if (ok) {
+    run_builders(b, n, build_part);
+    run_builders(b, n, merge_part);
+    for (uint32_t i = 1; i < n; i += 1) {
+      bf_merge(d->bf, b[i].bf);
+    }
+    for (uint32_t p = 0; p < 2 * n; p += 1) {
+      uint64_t keys = 0;
+      for (uint32_t i = 0; i < n; i += 1) {
+        keys += moved[2 * n * i + p];
+      }
+      ht_adopt(d->ht, b[p % n].ht[p / n], keys);
+    }
+    ht_rebalance(d->ht);
+  }
+  for (uint32_t i = 0; b && i < n; i += 1) {
+    if (i > 0) {
+      bf_delete(&b[i].bf);
+    }
+    ht_delete(&b[i].ht[0]);
+    ht_delete(&b[i].ht[1]);
+  }
+  free(b);
+  free(moved);
+  free(text[0]);
+  free(text[1]);
+  return ok;
+}
+
+// Returns true once the HashTable of the Dictionary is complete (always, but
+// while dict_load_fast is building it). Its nodes can then be looked up.
+bool dict_ready(Dictionary *d) {
+  return atomic_load_explicit(&d->ready, memory_order_acquire);
+}
+
+// Waits until the HashTable of the Dictionary is complete. Only the thread
+// that loaded the Dictionary may call it.
+void dict_wait(Dictionary *d) {
+  if (d->building) {
+    pthread_join(d->builder, NULL);
+    d->building = false;
+  }
+}
+
+// Makes the Dictionary look its words up in the Trie image at path (written
+// by --build-trie), which is mapped instead of read. Returns false if it
+// can't be mapped.
+bool dict_open_trie(Dictionary *d, char *path) {
+  return dict_set_trie(d, trie_open(path));
+}
+
+// Makes the Dictionary look its words up in the Trie t, which it then owns.
+// Returns false if t is NULL.
+bool dict_set_trie(Dictionary *d, Trie *t) {
+  d->trie = t;
+  return t != NULL;
+}
+
+// Makes the Dictionary look its words up in the hash file at path (written by
+// --build-disk), which stays on disk. Returns false if it can't be mapped.
+bool dict_open_disk(Dictionary *d, char *path) {
+  d->disk = dh_open(path);
+  return d->disk != NULL;
+}
+
+// Makes the Dictionary look its words up in the current generation of the
+// shared dictionary name (published by --shm-publish), mapped read-only.
+// Returns false if it can't be attached.
+bool dict_attach_shm(Dictionary *d, char *name) {
+  d->shm = name;
+  return dict_set_trie(d, shm_attach(name, &d->generation));
+}
+
+// Returns true if the Dictionary is attached to a shared dictionary that has
+// published a newer generation since
+bool dict_outdated(Dictionary *d) {
+  return d->shm != NULL && shm_generation(d->shm) != d->generation;
+}
+
+// Returns the generation of the shared dictionary the Dictionary is attached
+// to (0 if it isn't)
+uint64_t dict_generation(Dictionary *d) { return d->generation; }
+
+// Builds the next generation of a Dictionary: a new Dictionary with the same
+// sizes and options, loaded from the same files (or attached to the current
+// generation of the same shared dictionary). Returns NULL if it couldn't be
+// built, in which case the caller should keep using d.
+Dictionary *dict_rebuild(Dictionary *d) {
+  Dictionary *next = dict_create(d->ht_size, d->bf_size, d->mtf, d->counting);
+  if (next && d->shm && !dict_attach_shm(next, d->shm)) {
+    dict_delete(&next);
+  } else if (next && !d->shm && !dict_load(next, d->badspeak, d->newspeak)) {
+    dict_delete(&next);
+  }
+  return next;
+}
+
+// Returns true if the Dictionary can be updated in place: its BloomFilter is
+// a counting one, it doesn't look its words up in a Trie or a hash file, and
+// its HashTable is built
+static bool updatable(Dictionary *d) {
+  return d->counting && !d->trie && !d->disk && !d->shm && dict_ready(d);
+}
+
+// Reads the files of the Dictionary again into a new HashTable, for
+// dict_diff. Returns NULL if the Dictionary can't be updated in place or a
+// file can't be read.
+HashTable *dict_read(Dictionary *d) {
+  if (!updatable(d)) {
+    return NULL;
+  }
+  FILE *bad = NULL;
+  FILE *new = NULL;
+  HashTable *fresh = ht_create_like(d->ht);
+  if (fresh == NULL || !open_words(d, &bad, &new)) {
+    ht_delete(&fresh);
+    return NULL;
+  }
+  insert_file(bad, false, NULL, fresh);
+  insert_file(new, true, NULL, fresh);
+  return fresh;
+}
+
+// Inserts the word of a node into the HashTable arg
+static void copy_word(Node *n, void *arg) {
+  ht_insert((HashTable *)arg, n->oldspeak, n->newspeak);
+}
+
+// Copies the words of the HashTable of the Dictionary into a new HashTable,
+// which dict_diff compares the files with the next time they change. Returns
+// NULL if the Dictionary can't be updated in place (see dict_read) or the
+// memory couldn't be allocated. Nothing may write to the Dictionary
+// meanwhile, so this is done before it is used by any scan.
+HashTable *dict_words(Dictionary *d) {
+  if (!updatable(d)) {
+    return NULL;
+  }
+  HashTable *words = ht_create_like(d->ht);
+  if (words) {
+    ht_for_each(d->ht, copy_word, words);
+  }
+  return words;
+}
+
+// Defines the changes between two readings of the files, found by dict_diff.
+// gone holds the nodes (of the old HashTable) of the words to remove, and
+// added those (of the fresh one) of the words to insert. A word whose
+// newspeak changed is in both. dead is how many bytes of the arena of the
+// Dictionary the removed words leave unused.
+typedef struct Delta Delta;
+
+struct Delta {
+  HashTable *old;
+  HashTable *fresh;
+  Node **gone;
+  uint32_t n_gone;
+  uint32_t cap_gone;
+  Node **added;
+  uint32_t n_added;
+  uint32_t cap_added;
+  uint64_t dead;
+  bool ok;
+};
+
+// Appends the node n to the list of a Delta, growing it as needed
+static void delta_push(Delta *delta, Node ***list, uint32_t *n,
+                       uint32_t *cap, Node *node) {
+  if (*n == *cap) {
+    uint32_t grown = *cap ? *cap * 2 : 64;
+    Node **l = (Node **)realloc(*list, sizeof(Node *) * grown);
+    if (l == NULL) {
+      delta->ok = false;
+      return;
+    }
+    *list = l;
+    *cap = grown;
+  }
+  (*list)[(*n)++] = node;
+}
+
+// Returns true if both newspeaks are the same (or both NULL)
+static bool same_newspeak(char *a, char *b) {
+  return a == b || (a && b && strcmp(a, b) == 0);
+}
+
+// Adds a word of the old HashTable to the Delta if it isn't in the files
+// anymore, or if its newspeak changed
+static void find_gone(Node *n, void *arg) {
+  Delta *delta = (Delta *)arg;
+  Counters c;
+  counters_clear(&c);
+  Node *now = ht_lookup_r(delta->fresh, n->oldspeak, n->len, &c);
+  if (now == NULL || !same_newspeak(n->newspeak, now->newspeak)) {
+    delta_push(delta, &delta->gone, &delta->n_gone, &delta->cap_gone, n);
+    delta->dead +=
+        dict_word_bytes(n->len, n->newspeak ? strlen(n->newspeak) : 0);
+  }
+}
+
+// Adds a word of the files to the Delta if it isn't in the old HashTable, or
+// if its newspeak changed
+static void find_added(Node *n, void *arg) {
+  Delta *delta = (Delta *)arg;
+  Counters c;
+  counters_clear(&c);
+  Node *was = ht_lookup_r(delta->old, n->oldspeak, n->len, &c);
+  if (was == NULL || !same_newspeak(n->newspeak, was->newspeak)) {
+    delta_push(delta, &delta->added, &delta->n_added, &delta->cap_added, n);
+  }
+}
+
+// Compares the words the Dictionary holds (old, from dict_words or the fresh
+// HashTable of the last update) with those just read from the files (fresh,
+// from dict_read). Only reads the two HashTables, so the Dictionary can be
+// scanned meanwhile. The Delta points into both, which have to outlive it.
+// Returns NULL if either is NULL or the memory couldn't be allocated.
+Delta *dict_diff(HashTable *old, HashTable *fresh) {
+  if (old == NULL || fresh == NULL) {
+    return NULL;
+  }
+  Delta *delta = (Delta *)calloc(1, sizeof(Delta));
+  if (delta == NULL) {
+    return NULL;
+  }
+  delta->old = old;
+  delta->fresh = fresh;
+  delta->ok = true;
+  ht_for_each(old, find_gone, delta);
+  ht_for_each(fresh, find_added, delta);
+  if (!delta->ok) {
+    delta_delete(&delta);
+  }
+  return delta;
+}
+
+// The destructor for a Delta. Frees its lists (not the nodes, which belong to
+// the HashTables it was made from), frees it and sets the pointer to NULL.
+void delta_delete(Delta **delta) {
+  if (*delta) {
+    free((*delta)->gone);
+    free((*delta)->added);
+    free(*delta);
+    *delta = NULL;
+  }
+}
+
+// Returns the number of words the Delta removes or inserts
+uint64_t delta_size(Delta *delta) {
+  return (uint64_t)delta->n_gone + delta->n_added;
+}
+
+// Returns true if the Dictionary should be rebuilt rather than have delta
+// applied to it. A removed word's node stays in the arena of the HashTable
+// (it is freed with it), so once the removed words would take more bytes than
+// the HashTable has handed out for live ones, the memory is reclaimed by
+// building a new generation instead.
+bool dict_worn(Dictionary *d, Delta *delta) {
+  uint64_t dead = d->dead + delta->dead;
+  return 2 * dead > ht_bytes(d->ht);
+}
+
+// Applies the Delta to the Dictionary in place: the words that are gone are
+// removed from the BloomFilter and the HashTable with bf_remove and
+// ht_remove, then the new ones inserted, so the time it takes only depends on
+// the number of changes (but for an insert that rehashes the HashTable). The
+// Dictionary gets a new id, since its nodes did change. Nothing may look
+// words up in it meanwhile. Returns false if a word couldn't be removed from
+// the BloomFilter (its counters weren't what they should be), in which case
+// the caller should rebuild it.
+bool dict_apply(Dictionary *d, Delta *delta) {
+  bool ok = true;
+  for (uint32_t i = 0; i < delta->n_gone; i += 1) {
+    Node *n = delta->gone[i];
+    char word[MAX_PARSER_LINE_LENGTH + 1];
+    memcpy(word, n->oldspeak, n->len + 1);
+    ok = bf_remove(d->bf, word) && ok;
+    ht_remove(d->ht, word);
+  }
+  for (uint32_t i = 0; i < delta->n_added; i += 1) {
+    Node *n = delta->added[i];
+    ht_insert(d->ht, n->oldspeak, n->newspeak);
+    bf_insert(d->bf, n->oldspeak);
+  }
+  d->dead += delta->dead;
+  d->id = atomic_fetch_add(&next_id, 1);
+  return ok;
+}
+
+// Returns the BloomFilter of the Dictionary
+BloomFilter *dict_bf(Dictionary *d) { return d->bf; }
+
+// Returns the HashTable of the Dictionary
+HashTable *dict_ht(Dictionary *d) { return d->ht; }
+
+// Returns the Trie of the Dictionary (NULL if it doesn't use one)
+Trie *dict_trie(Dictionary *d) { return d->trie; }
+
+// Returns the DiskHash of the Dictionary (NULL if it doesn't use one)
+DiskHash *dict_disk(Dictionary *d) { return d->disk; }
+
+// Returns the number of bytes the words of the Dictionary take in its
+// HashTable (or would take, for a Trie, or once it is built). Copying any
+// subset of its words (with their newspeak) into an arena never takes more
+// than that. A hash file can hold far more words than fit in memory, so for
+// one it is capped to DICT_DISK_RESERVE, and an arena may have to grow.
+uint64_t dict_bytes(Dictionary *d) {
+  if (d->disk) {
+    uint64_t bytes = dh_node_bytes(d->disk);
+    return bytes < DICT_DISK_RESERVE ? bytes : DICT_DISK_RESERVE;
+  }
+  if (d->trie) {
+    return trie_node_bytes(d->trie);
+  }
+  return dict_ready(d) ? ht_bytes(d->ht) : d->reserve;
+}
+
+// Returns the id of the Dictionary. Unlike its address, the id of a deleted
+// Dictionary is never reused, so it tells whether anything remembered about a
+// Dictionary (such as a Node pointer) is still valid.
+uint64_t dict_id(Dictionary *d) { return d->id; }
+
+// Gathers the statistics of a scan with the Dictionary into s. c holds the
+// counters of the threads that only read the Dictionary; those of the
+// BloomFilter and HashTable themselves (kept by bf_probe and ht_lookup) are
+// added to them. elapsed_ns is how long the scan took.
+void dict_snapshot(Dictionary *d, Counters *c, uint64_t elapsed_ns,
+                   Snapshot *s) {
+  uint64_t bf_hits = 0;
+  uint64_t bf_misses = 0;
+  uint64_t bf_examined = 0;
+  uint64_t ht_hits = 0;
+  uint64_t ht_misses = 0;
+  uint64_t ht_examined = 0;
+  s->bf_keys = s->ht_keys = 0;
+  if (d->bf) {
+    bf_stats(d->bf, &s->bf_keys, &bf_hits, &bf_misses, &bf_examined);
+  }
+  if (d->ht) {
+    ht_stats(d->ht, &s->ht_keys, &ht_hits, &ht_misses, &ht_examined);
+  }
+  s->counters = *c;
+  s->counters.bf_hits += bf_hits;
+  s->counters.bf_misses += bf_misses;
+  s->counters.bf_bits_examined += bf_examined;
+  s->counters.ht_hits += ht_hits;
+  s->counters.ht_misses += ht_misses;
+  s->counters.ht_examined += ht_examined;
+  s->bf_size = d->bf ? bf_size(d->bf) : 0;
+  s->bf_set = d->bf ? bf_count(d->bf) : 0;
+  s->ht_max_chain = d->ht ? ht_max_chain(d->ht) : 0;
+  s->ht_rehashes = d->ht ? ht_rehashes(d->ht) : 0;
+  s->trie_keys = d->trie ? trie_keys(d->trie) : 0;
+  s->trie_cells = d->trie ? trie_cells(d->trie) : 0;
+  s->trie_size = d->trie ? trie_size(d->trie) : 0;
+  s->disk_keys = d->disk ? dh_keys(d->disk) : 0;
+  s->disk_buckets = d->disk ? dh_buckets(d->disk) : 0;
+  s->disk_size = d->disk ? dh_size(d->disk) : 0;
+  s->elapsed_ns = elapsed_ns;
+  snapshot_derive(s, N_HASHES);
+}
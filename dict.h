@@ -0,0 +1,84 @@
+#ifndef __DICT_H__
+#define __DICT_H__
+
+#include "bf.h"
+#include "dh.h"
+#include "ht.h"
+#include "shm.h"
+#include "trie.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define BADSPEAK_FILE "badspeak.txt"
+#define NEWSPEAK_FILE "newspeak.txt"
+
+// Most bytes reserved up front for the offenses of a hash file dictionary
+#define DICT_DISK_RESERVE (16 << 20)
+
+typedef struct Dictionary Dictionary;
+
+typedef struct Delta Delta;
+
+Dictionary *dict_create(uint32_t ht_size, uint32_t bf_size, bool mtf,
+                        bool counting);
+
+void dict_delete(Dictionary **d);
+
+bool dict_load(Dictionary *d, char *badspeak, char *newspeak);
+
+bool dict_load_parallel(Dictionary *d, char *badspeak, char *newspeak,
+                        uint32_t n);
+
+bool dict_load_fast(Dictionary *d, char *badspeak, char *newspeak);
+
+bool dict_ready(Dictionary *d);
+
+void dict_wait(Dictionary *d);
+
+bool dict_open_trie(Dictionary *d, char *path);
+
+bool dict_set_trie(Dictionary *d, Trie *t);
+
+bool dict_open_disk(Dictionary *d, char *path);
+
+bool dict_attach_shm(Dictionary *d, char *name);
+
+bool dict_outdated(Dictionary *d);
+
+uint64_t dict_generation(Dictionary *d);
+
+Dictionary *dict_rebuild(Dictionary *d);
+
+HashTable *dict_read(Dictionary *d);
+
+HashTable *dict_words(Dictionary *d);
+
+Delta *dict_diff(HashTable *old, HashTable *fresh);
+
+void delta_delete(Delta **delta);
+
+uint64_t delta_size(Delta *delta);
+
+bool dict_worn(Dictionary *d, Delta *delta);
+
+bool dict_apply(Dictionary *d, Delta *delta);
+
+BloomFilter *dict_bf(Dictionary *d);
+
+HashTable *dict_ht(Dictionary *d);
+
+Trie *dict_trie(Dictionary *d);
+
+DiskHash *dict_disk(Dictionary *d);
+
+uint64_t dict_id(Dictionary *d);
+
+uint64_t dict_bytes(Dictionary *d);
+
+uint64_t dict_word_bytes(uint64_t len, uint64_t new_len);
+
+void dict_snapshot(Dictionary *d, Counters *c, uint64_t elapsed_ns,
+                   Snapshot *s);
+
+#endif
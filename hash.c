@@ -0,0 +1,177 @@
+#include "hash.h"
+#include "city.h"
+#include "cpu.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__x86_64__)
+#include <nmmintrin.h>
+#endif
+
+// All the hashes take (ptr, len, seed), so none of them needs a '\0' or
+// strlen. The seed is the salt of the Bloom filter or hash table. The default
+// is CityHash64WithSeed from city.c.
+
+// wyhash (final version 4 structure): folded 64x64->128 multiplies, with
+// branch-light loads for keys up to 16 bytes, which covers most words.
+__extension__ typedef unsigned __int128 wy_u128;
+
+#define WY_P0 0xa0761d6478bd642full
+#define WY_P1 0xe7037ed1a0b428dbull
+#define WY_P2 0x8ebc6af09c88c6e3ull
+#define WY_P3 0x589965cc75374cc3ull
+
+// Multiplies a and b and folds the 128-bit product into 64 bits
+static inline uint64_t wy_mum(uint64_t a, uint64_t b) {
+  wy_u128 r = (wy_u128)a * b;
+  return (uint64_t)r ^ (uint64_t)(r >> 64);
+}
+
+static inline uint64_t wy_r8(const uint8_t *p) {
+  uint64_t v;
+  memcpy(&v, p, 8);
+  return v;
+}
+
+static inline uint64_t wy_r4(const uint8_t *p) {
+  uint32_t v;
+  memcpy(&v, p, 4);
+  return v;
+}
+
+// Reads 1-3 bytes as one value
+static inline uint64_t wy_r3(const uint8_t *p, size_t k) {
+  return (((uint64_t)p[0]) << 16) | (((uint64_t)p[k >> 1]) << 8) | p[k - 1];
+}
+
+uint64_t hash_wy(const char *s, size_t len, uint64_t seed) {
+  const uint8_t *p = (const uint8_t *)s;
+  seed ^= wy_mum(seed ^ WY_P0, WY_P1);
+  uint64_t a;
+  uint64_t b;
+  if (len <= 16) {
+    if (len >= 4) {
+      a = (wy_r4(p) << 32) | wy_r4(p + ((len >> 3) << 2));
+      b = (wy_r4(p + len - 4) << 32) | wy_r4(p + len - 4 - ((len >> 3) << 2));
+    } else if (len > 0) {
+      a = wy_r3(p, len);
+      b = 0;
+    } else {
+      a = b = 0;
+    }
+  } else {
+    size_t i = len;
+    if (i > 48) {
+      uint64_t see1 = seed;
+      uint64_t see2 = seed;
+      do {
+        seed = wy_mum(wy_r8(p) ^ WY_P1, wy_r8(p + 8) ^ seed);
+        see1 = wy_mum(wy_r8(p + 16) ^ WY_P2, wy_r8(p + 24) ^ see1);
+        see2 = wy_mum(wy_r8(p + 32) ^ WY_P3, wy_r8(p + 40) ^ see2);
+        p += 48;
+        i -= 48;
+      } while (i > 48);
+      seed ^= see1 ^ see2;
+    }
+    while (i > 16) {
+      seed = wy_mum(wy_r8(p) ^ WY_P1, wy_r8(p + 8) ^ seed);
+      i -= 16;
+      p += 16;
+    }
+    a = wy_r8(p + i - 16);
+    b = wy_r8(p + i - 8);
+  }
+  wy_u128 r = (wy_u128)(a ^ WY_P1) * (b ^ seed);
+  a = (uint64_t)r;
+  b = (uint64_t)(r >> 64);
+  return wy_mum(a ^ WY_P0 ^ len, b ^ WY_P1);
+}
+
+#if defined(__x86_64__)
+// Hardware CRC32C over 8 bytes per instruction, in two lanes. CRC is linear,
+// so the second lane sees the words multiplied by an odd constant and the two
+// lanes are run through a multiply-xorshift finalizer with the seed; without
+// that, different salts would only XOR the same value and keys that collide
+// under one salt would collide under all of them.
+__attribute__((target("sse4.2"))) uint64_t hash_crc32c(const char *s,
+                                                       size_t len,
+                                                       uint64_t seed) {
+  const uint8_t *p = (const uint8_t *)s;
+  uint64_t h1 = (uint32_t)seed;
+  uint64_t h2 = seed >> 32;
+  size_t i = len;
+  while (i >= 8) {
+    uint64_t v = wy_r8(p);
+    h1 = _mm_crc32_u64(h1, v);
+    h2 = _mm_crc32_u64(h2, v * WY_P2);
+    p += 8;
+    i -= 8;
+  }
+  if (i > 0) {
+    // The last 1-7 bytes, read without a variable-length copy: an
+    // overlapping load when the key had a full word, else the wyhash reads
+    uint64_t v;
+    if (len >= 8) {
+      v = wy_r8(p + i - 8);
+    } else if (i >= 4) {
+      v = (wy_r4(p) << 32) | wy_r4(p + i - 4);
+    } else {
+      v = wy_r3(p, i);
+    }
+    h1 = _mm_crc32_u64(h1, v);
+    h2 = _mm_crc32_u64(h2, v * WY_P2);
+  }
+  uint64_t h = ((h1 << 32) | h2) ^ seed ^ len;
+  h = (h ^ (h >> 33)) * 0xff51afd7ed558ccdull;
+  h = (h ^ (h >> 33)) * 0xc4ceb9fe1a85ec53ull;
+  return h ^ (h >> 33);
+}
+#else
+// Without x86-64 there is no CRC32C instruction; the backend is never bound
+// (its level is above anything cpu_detect returns), this only keeps it linked.
+uint64_t hash_crc32c(const char *s, size_t len, uint64_t seed) {
+  return hash_wy(s, len, seed);
+}
+#endif
+
+// The backends. cpu_init binds crc32c if the CPU has SSE4.2, and city if not
+const HashBackend hash_backends[] = {
+    {"city", CityHash64WithSeed, CPU_SCALAR},
+    {"wyhash", hash_wy, CPU_SCALAR},
+#if defined(__x86_64__)
+    {"crc32c", hash_crc32c, CPU_SSE42},
+#else
+    {"crc32c", hash_crc32c, CPU_AVX512 + 1},
+#endif
+};
+
+const uint32_t n_hash_backends = sizeof(hash_backends) / sizeof(HashBackend);
+
+// Binds the backend with the given name as the hash of the Bloom filter and
+// hash table. Must be called after cpu_init and before they are created.
+// "auto" keeps the backend cpu_init bound. Returns false if there is no such
+// backend or the CPU can't run it.
+bool hash_select(const char *name) {
+  if (strcmp(name, "auto") == 0) {
+    return true;
+  }
+  for (uint32_t i = 0; i < n_hash_backends; i += 1) {
+    if (strcmp(name, hash_backends[i].name) == 0 &&
+        hash_backends[i].level <= kernels.level) {
+      kernels.hash64 = hash_backends[i].fn;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Returns the name of the backend in use
+const char *hash_name(void) {
+  for (uint32_t i = 0; i < n_hash_backends; i += 1) {
+    if (kernels.hash64 == hash_backends[i].fn) {
+      return hash_backends[i].name;
+    }
+  }
+  return "unknown";
+}
@@ -0,0 +1,32 @@
+#ifndef __HASH_H__
+#define __HASH_H__
+
+#include "cpu.h"
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// A hash backend: its name, the function and the lowest instruction set level
+// it needs
+typedef struct HashBackend HashBackend;
+
+struct HashBackend {
+  const char *name;
+  hash64_fn fn;
+  uint32_t level;
+};
+
+extern const HashBackend hash_backends[];
+
+extern const uint32_t n_hash_backends;
+
+uint64_t hash_wy(const char *s, size_t len, uint64_t seed);
+
+uint64_t hash_crc32c(const char *s, size_t len, uint64_t seed);
+
+bool hash_select(const char *name);
+
+const char *hash_name(void);
+
+#endif
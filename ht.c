@@ -1,10 +1,23 @@
 #include "ht.h"
+#include "arena.h"
 #include "city.h"
+#include "cpu.h"
 #include "ll.h"
+#include "seed.h"
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
+
+// Size of the chunks the strings of the nodes are allocated from
+#define ARENA_CHUNK 65536
+
+// A chain longer than CHAIN_SLACK plus CHAIN_FACTOR times the average chain
+// length means the keys collide far more than random keys would (a bad or
+// guessed salt), so the table picks a new salt and rehashes.
+#define CHAIN_SLACK 8
+#define CHAIN_FACTOR 4
 
 // Defines what members/fields the HashTable has.
 // Salt is acting as a key to a vector.
@@ -12,34 +25,43 @@
 // n_keys tracks the number of keys inputed to the structure. n_hits
 // tracks the number of lookups that return true. n_misses track the number of
 // lookups that return false. n_bits_examined tracks that the total number of
-// bits examined (using stats from LinkedList)
+// bits examined (using stats from LinkedList). arena holds all the nodes and
+// their oldspeak and newspeak strings (short oldspeaks are kept in the nodes).
+// n_rehashes counts how many times a long chain made the table pick a new salt.
+// A part (made by ht_create_like) is never rehashed, since its nodes are going
+// to be merged into a table with the same salt.
 typedef struct HashTable HashTable;
 
 struct HashTable {
   uint64_t salt;
   uint32_t size;
-  uint32_t n_keys;
-  uint32_t n_hits;
-  uint32_t n_misses;
-  uint32_t n_examined;
+  uint64_t n_keys;
+  uint64_t n_hits;
+  uint64_t n_misses;
+  uint64_t n_examined;
+  uint64_t n_rehashes;
   bool mtf;
+  bool part;
   LinkedList **lists;
+  Arena *arena;
 };
 
-// The constructor for the LinkedList. Creates a new LinkedList and returns a
-// pointer to it if the memory was allocated succesfully. Else, return NULL
-// Takes a bool mtf that sets the mtf member to it. Takes a size argument that
-// sets the size of the HashTable.
-HashTable *ht_create(uint32_t size, bool mtf) {
+// Creates a HashTable like ht_create does, with the given salt
+static HashTable *create(uint32_t size, bool mtf, uint64_t salt) {
   HashTable *ht = (HashTable *)malloc(sizeof(HashTable));
   if (ht != NULL) {
     ht->mtf = mtf;
-    ht->salt = 0x9846e4f157fe8840;
+    ht->part = false;
+    ht->salt = salt;
     ht->n_hits = ht->n_misses = ht->n_examined = 0;
+    ht->n_rehashes = 0;
     ht->n_keys = 0;
     ht->size = size;
     ht->lists = (LinkedList **)calloc(size, sizeof(LinkedList *));
-    if (!ht->lists) {
+    ht->arena = arena_create(ARENA_CHUNK);
+    if (!ht->lists || !ht->arena) {
+      free(ht->lists);
+      arena_delete(&ht->arena);
       free(ht);
       ht = NULL;
     }
@@ -47,6 +69,25 @@ HashTable *ht_create(uint32_t size, bool mtf) {
   return ht;
 }
 
+// The constructor for the LinkedList. Creates a new LinkedList and returns a
+// pointer to it if the memory was allocated succesfully. Else, return NULL
+// Takes a bool mtf that sets the mtf member to it. Takes a size argument that
+// sets the size of the HashTable.
+HashTable *ht_create(uint32_t size, bool mtf) {
+  return create(size, mtf, seed_next()); // Salt from the per-process seed
+}
+
+// Creates an empty HashTable with the same size, options and salt as ht, so
+// that it can be filled separately (by another thread) and merged into ht with
+// ht_merge. Returns NULL if the memory couldn't be allocated.
+HashTable *ht_create_like(HashTable *ht) {
+  HashTable *like = create(ht->size, ht->mtf, ht->salt);
+  if (like) {
+    like->part = true;
+  }
+  return like;
+}
+
 // The destructor for a HashTable
 // Frees all LinkedLists and set them to NULL, the HashTable object, and the
 // lists member
@@ -60,6 +101,7 @@ void ht_delete(HashTable **ht) {
     // Delete the lists member
     free((*ht)->lists);
     (*ht)->lists = NULL;
+    arena_delete(&(*ht)->arena); // Frees the strings of all the nodes
     // Delete the HashTable object
     free(*ht);
     *ht = NULL;
@@ -69,21 +111,31 @@ void ht_delete(HashTable **ht) {
 // Returns the size member of the HashTable
 uint32_t ht_size(HashTable *ht) { return ht->size; }
 
-Node *ht_lookup(HashTable *ht, char *oldspeak) {
+// Fingerprint stored in each node: the high half of the key's hash, so the
+// low bits used for the index and the fingerprint are independent.
+#define FINGERPRINT(h) ((uint32_t)((h) >> 32))
+
+// Searches the HashTable for an oldspeak of length len. oldspeak has to be
+// zero padded to NODE_INLINE bytes, the way next_word returns words.
+// The key is hashed once; the same hash picks the LinkedList and gives the
+// fingerprint that rejects most non-matching nodes with an integer compare.
+// Returns the node if it was found. Else, return NULL
+Node *ht_lookup(HashTable *ht, char *oldspeak, uint32_t len) {
   // LinkedList stats before running lookup
-  uint32_t seeks = 0;
-  uint32_t links = 0;
+  uint64_t seeks = 0;
+  uint64_t links = 0;
   // LinkedList stats at the end
-  uint32_t u_seeks = 0;
-  uint32_t u_links = 0;
+  uint64_t u_seeks = 0;
+  uint64_t u_links = 0;
   ll_stats(&seeks, &links);
   // find the index of the linked list
-  uint64_t h = hash(ht->salt, oldspeak);
-  h = h % (ht_size(ht));
+  uint64_t k = kernels.hash64(oldspeak, len, ht->salt);
+  uint64_t h = k % (ht_size(ht));
   // if it exists
   if (ht->lists[h] != NULL) {
     // Find the index of the LinkedList that holds the oldspeak
-    Node *n = ll_lookup(ht->lists[h], oldspeak); // Save the oldspeak's node
+    Node *n = ll_lookup(ht->lists[h], oldspeak, len,
+                        FINGERPRINT(k)); // Save the oldspeak's node
     ll_stats(&u_seeks,
              &u_links); // Call stats again and calculate the difference
     ht->n_examined += (u_links - links);
@@ -102,44 +154,172 @@ Node *ht_lookup(HashTable *ht, char *oldspeak) {
   }
 }
 
+// Same as ht_lookup, but nothing shared is written to: the stats are added to
+// the given Counters and move-to-front is skipped. This lets many threads look
+// words up in the same HashTable at once, as long as nobody inserts into it.
+Node *ht_lookup_r(HashTable *ht, char *oldspeak, uint32_t len, Counters *c) {
+  uint64_t k = kernels.hash64(oldspeak, len, ht->salt);
+  LinkedList *ll = ht->lists[k % ht_size(ht)];
+  Node *n = NULL;
+  if (ll != NULL) {
+    n = ll_lookup_r(ll, oldspeak, len, FINGERPRINT(k), &c->ht_examined);
+  }
+  if (n) {
+    c->ht_hits += 1;
+  } else {
+    c->ht_misses += 1;
+  }
+  return n;
+}
+
+// Copies oldspeak into key, zero padded to NODE_INLINE bytes, so that it can
+// be compared against the inline keys of the nodes. Returns its length.
+static uint32_t pad_key(char *key, char *oldspeak) {
+  uint32_t len = strlen(oldspeak);
+  if (len < NODE_INLINE) {
+    memset(key, 0, NODE_INLINE);
+    memcpy(key, oldspeak, len);
+  }
+  return len;
+}
+
+// Picks a new salt and moves every node to the list its key hashes to with
+// it. The nodes (and their strings) are reused; only their fingerprints,
+// which depend on the salt, are recomputed.
+static void rehash(HashTable *ht) {
+  LinkedList **old = ht->lists;
+  LinkedList **lists = (LinkedList **)calloc(ht->size, sizeof(LinkedList *));
+  if (lists == NULL) {
+    return; // Keep the old salt rather than lose keys
+  }
+  ht->salt = seed_next();
+  ht->lists = lists;
+  for (uint32_t i = 0; i < ht->size; i += 1) {
+    if (old[i]) {
+      Node *n;
+      while ((n = ll_pop(old[i])) != NULL) {
+        uint64_t k = kernels.hash64(n->oldspeak, n->len, ht->salt);
+        uint64_t h = k % ht->size;
+        n->fp = FINGERPRINT(k);
+        if (ht->lists[h] == NULL) {
+          ht->lists[h] = ll_create(ht->mtf, ht->arena);
+        }
+        ll_push(ht->lists[h], n);
+      }
+      ll_delete(&old[i]);
+    }
+  }
+  free(old);
+  ht->n_rehashes += 1;
+}
+
 // Inserts a new oldspeak-newspeak pair into the HashTable.
 // If the index of the LinkedList to insert doesn't exist, create the LinkedList
-// and insert the values
-void ht_insert(HashTable *ht, char *oldspeak, char *newspeak) {
+// and insert the values. If the list got much longer than the average list,
+// the HashTable is rehashed with a new salt. Returns true if the oldspeak
+// wasn't already in the HashTable (and so was added).
+bool ht_insert(HashTable *ht, char *oldspeak, char *newspeak) {
+  char key[NODE_INLINE];
+  uint32_t len = pad_key(key, oldspeak);
+  if (len < NODE_INLINE) {
+    oldspeak = key;
+  }
   // find the index of the linked list to insert into
-  uint64_t h = hash(ht->salt, oldspeak);
-  h = h % (ht_size(ht));
-  uint64_t s =
-      ht->size; // Change the size to 64 bits to match with the hash index
-  // Loop through all the LinkedLists until finding the one with the correct
-  // index
-  for (uint64_t i = 0; i < s; i += 1) {
-    // if the linked list with the index exists
-    if (i == h) {
-      if (ht->lists[i]) { // Insert the oldspeak and new speak
-        uint32_t l_before = ll_length(ht->lists[i]);
-        ll_insert(ht->lists[i], oldspeak, newspeak);
-        uint32_t l_after = ll_length(ht->lists[i]);
-        if (l_before != l_after) { 
-          	ht->n_keys += 1;
-        }
-        break;
-      } else {
-        // Create a new LinkedList, insert it to the lists memebr, and insert
-        // the args
-        ht->lists[h] = ll_create(ht->mtf);
-        ll_insert(ht->lists[h], oldspeak, newspeak);
-          	ht->n_keys += 1;
-        break;
-      }
+  uint64_t k = kernels.hash64(oldspeak, len, ht->salt);
+  uint64_t h = k % (ht_size(ht));
+  if (ht->lists[h] == NULL) {
+    // Create a new LinkedList and insert it to the lists member
+    ht->lists[h] = ll_create(ht->mtf, ht->arena);
+  }
+  // Insert the oldspeak and newspeak. Increase the number of keys if it
+  // wasn't already there
+  uint32_t l_before = ll_length(ht->lists[h]);
+  ll_insert(ht->lists[h], oldspeak, newspeak, len, FINGERPRINT(k));
+  uint32_t l_after = ll_length(ht->lists[h]);
+  if (l_before != l_after) {
+    ht->n_keys += 1;
+  }
+  if (!ht->part &&
+      l_after > CHAIN_SLACK + CHAIN_FACTOR * (ht->n_keys / ht->size)) {
+    rehash(ht);
+  }
+  return l_before != l_after;
+}
+
+// Moves the nodes of the lists from to to - 1 of src into the same lists of
+// dst, except those whose oldspeak dst already has, so that dst ends up as if
+// the words of src had been inserted into it after its own. Both tables must
+// have the same size and salt (src made by ht_create_like(dst)). Threads can
+// merge disjoint ranges of lists at once; ht_adopt must then be called once
+// all of src was merged. Returns the number of nodes moved.
+uint64_t ht_merge(HashTable *dst, HashTable *src, uint32_t from, uint32_t to) {
+  uint64_t moved = 0;
+  for (uint32_t i = from; i < to && i < dst->size; i += 1) {
+    if (src->lists[i] == NULL || ll_length(src->lists[i]) == 0) {
+      continue;
+    }
+    if (dst->lists[i] == NULL) {
+      dst->lists[i] = ll_create(dst->mtf, dst->arena);
     }
+    moved += ll_move(dst->lists[i], src->lists[i]);
+  }
+  return moved;
+}
+
+// Finishes merging src into dst: dst takes over the memory of the nodes that
+// were moved and counts the keys ht_merge moved. src keeps only the nodes that
+// weren't moved.
+void ht_adopt(HashTable *dst, HashTable *src, uint64_t keys) {
+  arena_absorb(dst->arena, src->arena);
+  dst->n_keys += keys;
+  src->n_keys -= keys;
+}
+
+// Rehashes the HashTable with a new salt if its longest chain is too long for
+// the number of keys, the check ht_insert makes after each insert. Called once
+// all the parts of a HashTable were merged into it. Since it only sees the
+// final chains, it may rehash where inserting the same words one at a time
+// wouldn't have, or not where it would have.
+void ht_rebalance(HashTable *ht) {
+  if (!ht->part &&
+      ht_max_chain(ht) > CHAIN_SLACK + CHAIN_FACTOR * (ht->n_keys / ht->size)) {
+    rehash(ht);
+  }
+}
+
+// Removes an oldspeak (and its newspeak, if any) from the HashTable.
+// Returns true if the oldspeak was in the HashTable. The node and its strings
+// are in the arena of the HashTable, so their memory is only freed with it
+// (dict_apply keeps count, and has the Dictionary rebuilt when too much of
+// it is unused).
+bool ht_remove(HashTable *ht, char *oldspeak) {
+  char key[NODE_INLINE];
+  uint32_t len = pad_key(key, oldspeak);
+  if (len < NODE_INLINE) {
+    oldspeak = key;
+  }
+  // find the index of the linked list that would hold the oldspeak
+  uint64_t k = kernels.hash64(oldspeak, len, ht->salt);
+  uint64_t h = k % (ht_size(ht));
+  if (ht->lists[h] != NULL &&
+      ll_remove(ht->lists[h], oldspeak, len, FINGERPRINT(k))) {
+    ht->n_keys -= 1; // One less key in the table
+    return true;
+  }
+  return false;
+}
+
+// Calls fn with every node of the HashTable (and arg). fn may remove the node
+// it is given from the HashTable, but nothing else.
+void ht_for_each(HashTable *ht, void (*fn)(Node *n, void *arg), void *arg) {
+  for (uint32_t i = 0; i < ht->size; i += 1) {
+    ll_for_each(ht->lists[i], fn, arg);
   }
-  // Increase the number of keys because there's a new value
- // if (ll_lookup(ht->lists[h], oldspeak) == NULL) {
- // 	ht->n_keys += 1;
- // }
 }
 
+// Returns the number of bytes the nodes and strings of the HashTable take
+uint64_t ht_bytes(HashTable *ht) { return arena_bytes(ht->arena); }
+
 // Returns the number of non-NULL LinkedLists in the HashTable
 uint32_t ht_count(HashTable *ht) {
   uint32_t count = 0;
@@ -160,15 +340,42 @@ void ht_print(HashTable *ht) {
   for (uint64_t i = 0; i < s; i += 1) {
     ll_print(ht->lists[i]);
   }
-  printf("mtf (1=true, 0=false): %d, salt: %lu, size: %d, n_keys: %d, "
-         "n_misses: %d, n_hits: %d, n_examined: %d\n",
+  printf("mtf (1=true, 0=false): %d, salt: %lu, size: %d, n_keys: %lu, "
+         "n_misses: %lu, n_hits: %lu, n_examined: %lu\n",
          ht->mtf, ht->salt, ht->size, ht->n_keys, ht->n_misses, ht->n_hits,
          ht->n_examined);
 }
 
+// Returns the length of the longest LinkedList in the HashTable
+uint64_t ht_max_chain(HashTable *ht) {
+  uint64_t max = 0;
+  for (uint32_t i = 0; i < ht->size; i += 1) {
+    if (ht->lists[i] != NULL && ll_length(ht->lists[i]) > max) {
+      max = ll_length(ht->lists[i]);
+    }
+  }
+  return max;
+}
+
+// Fills hist with the number of lists of each length: hist[i] is the number
+// of lists with i nodes (empty buckets count as length 0) and the last entry
+// also counts every longer list
+void ht_chain_lengths(HashTable *ht, uint32_t *hist, uint32_t n) {
+  for (uint32_t i = 0; i < n; i += 1) {
+    hist[i] = 0;
+  }
+  for (uint32_t i = 0; i < ht->size; i += 1) {
+    uint32_t l = ht->lists[i] != NULL ? ll_length(ht->lists[i]) : 0;
+    hist[l < n ? l : n - 1] += 1;
+  }
+}
+
+// Returns the number of times the HashTable was rehashed with a new salt
+uint64_t ht_rehashes(HashTable *ht) { return ht->n_rehashes; }
+
 // Sets the stats (keys, hits, misses, and examined)
-void ht_stats(HashTable *ht, uint32_t *nk, uint32_t *nh, uint32_t *nm,
-              uint32_t *ne) {
+void ht_stats(HashTable *ht, uint64_t *nk, uint64_t *nh, uint64_t *nm,
+              uint64_t *ne) {
   *nk = ht->n_keys;
   *nh = ht->n_hits;
   *nm = ht->n_misses;
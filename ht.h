@@ -2,6 +2,7 @@
 #define __HT_H__
 
 #include "ll.h"
+#include "stats.h"
 
 #include <stdbool.h>
 #include <stdint.h>
@@ -10,18 +11,40 @@ typedef struct HashTable HashTable;
 
 HashTable *ht_create(uint32_t size, bool mtf);
 
+HashTable *ht_create_like(HashTable *ht);
+
 void ht_delete(HashTable **ht);
 
+uint64_t ht_merge(HashTable *dst, HashTable *src, uint32_t from, uint32_t to);
+
+void ht_adopt(HashTable *dst, HashTable *src, uint64_t keys);
+
+void ht_rebalance(HashTable *ht);
+
 uint32_t ht_size(HashTable *ht);
 
-Node *ht_lookup(HashTable *ht, char *oldspeak);
+Node *ht_lookup(HashTable *ht, char *oldspeak, uint32_t len);
+
+Node *ht_lookup_r(HashTable *ht, char *oldspeak, uint32_t len, Counters *c);
+
+bool ht_insert(HashTable *ht, char *oldspeak, char *newspeak);
 
-void ht_insert(HashTable *ht, char *oldspeak, char *newspeak);
+bool ht_remove(HashTable *ht, char *oldspeak);
+
+void ht_for_each(HashTable *ht, void (*fn)(Node *n, void *arg), void *arg);
 
 uint32_t ht_count(HashTable *ht);
 
+uint64_t ht_bytes(HashTable *ht);
+
+uint64_t ht_max_chain(HashTable *ht);
+
+uint64_t ht_rehashes(HashTable *ht);
+
+void ht_chain_lengths(HashTable *ht, uint32_t *hist, uint32_t n);
+
 void ht_print(HashTable *ht);
 
-void ht_stats(HashTable *ht, uint32_t *nk, uint32_t *nh, uint32_t *nm, uint32_t *ne);
+void ht_stats(HashTable *ht, uint64_t *nk, uint64_t *nh, uint64_t *nm, uint64_t *ne);
 
 #endif
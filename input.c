@@ -0,0 +1,714 @@
+#define _GNU_SOURCE // For fopencookie
+#include "input.h"
+#include "decomp.h"
+#include <errno.h>
+#include <linux/io_uring.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+// Blocks are aligned like pages, which the kernel copies into fastest
+#define INPUT_ALIGN 4096
+
+static const char *engine_names[] = {"stdio", "read", "uring", "auto"};
+
+// Defines a block of an Input. n bytes of it were read so far, and the read
+// in flight (if busy) fills it from there. done is set once it is complete:
+// full, or the end of the input was reached (eof), or the read failed.
+typedef struct Slot Slot;
+
+struct Slot {
+  char *buf;
+  uint64_t n;
+  uint64_t offset;
+  bool busy;
+  bool done;
+  bool eof;
+};
+
+// Defines the io_uring of an Input: the submission and completion rings
+// shared with the kernel, and the submission queue entries. fixed is set if
+// the blocks were registered with the kernel, so it doesn't map them on every
+// read.
+typedef struct Ring Ring;
+
+struct Ring {
+  int fd;
+  void *sq_map;
+  uint64_t sq_map_size;
+  void *cq_map;
+  uint64_t cq_map_size;
+  struct io_uring_sqe *sqes;
+  uint64_t sqes_size;
+  _Atomic uint32_t *sq_head;
+  _Atomic uint32_t *sq_tail;
+  uint32_t *sq_mask;
+  uint32_t *sq_array;
+  _Atomic uint32_t *cq_head;
+  _Atomic uint32_t *cq_tail;
+  uint32_t *cq_mask;
+  struct io_uring_cqe *cqes;
+  bool fixed;
+};
+
+// Defines what members/fields the Input has.
+// The input is read from fd into a ring of depth blocks of block bytes. Block
+// number s (counting from the start of the input) goes in slots[s % depth].
+// submitted blocks were handed to the engine, and delivered of them to the
+// reader; the one that was delivered last is being read, at pos of its n
+// bytes (data). offset is where the next block starts in the file, if it is
+// a regular file (seekable), which lets several reads be in flight at once; a
+// pipe is read one block at a time. eof is set once the end of the input was
+// reached, and ended once the reader got there. waits counts the blocks the
+// reader had to wait for.
+// The first n_head bytes of the input are read up front into head, to tell
+// its format. Compressed input is decompressed straight into the blocks by
+// the decoder thread, which hands them over to the reader under lock
+// (signaling filled) and waits for them to be given back (freed); stop tells
+// it to quit early. failed is set if a read failed or the input couldn't be
+// decompressed.
+// With INPUT_AUTO (fallback), the first io_uring read may still be rejected
+// by a kernel that has io_uring but not the reads it is given (rejected),
+// and the Input then goes on with read(2). read_any is set once a read of the
+// ring completed, after which an error is a failure like any other.
+typedef struct Input Input;
+
+struct Input {
+  int fd;
+  uint32_t engine;
+  uint32_t depth;
+  uint64_t block;
+  bool seekable;
+  uint64_t offset;
+  Slot *slots;
+  uint64_t submitted;
+  uint64_t delivered;
+  uint32_t in_flight;
+  bool eof;
+  char *data;
+  uint64_t n;
+  uint64_t pos;
+  uint64_t waits;
+  bool ended;
+  Ring ring;
+  char head[DECOMP_MAGIC];
+  uint32_t n_head;
+  uint32_t format;
+  Decoder *decoder;
+  pthread_t thread;
+  bool threaded;
+  pthread_mutex_t lock;
+  pthread_cond_t filled;
+  pthread_cond_t freed;
+  bool stop;
+  bool failed;
+  bool fallback;
+  bool rejected;
+  bool read_any;
+};
+
+// Sets up the io_uring of the Input, with room for a read per block, and
+// registers the blocks with it (if the kernel allows, else the reads aren't
+// fixed). Returns false if io_uring isn't available.
+static bool ring_setup(Input *in) {
+  Ring *r = &in->ring;
+  struct io_uring_params p;
+  memset(&p, 0, sizeof(p));
+  r->fd = syscall(__NR_io_uring_setup, in->depth, &p);
+  if (r->fd < 0) {
+    return false;
+  }
+  r->sq_map_size = p.sq_off.array + p.sq_entries * sizeof(uint32_t);
+  r->cq_map_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+  bool single = p.features & IORING_FEAT_SINGLE_MMAP;
+  if (single && r->cq_map_size > r->sq_map_size) {
+    r->sq_map_size = r->cq_map_size;
+  }
+  r->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+  r->sq_map = mmap(NULL, r->sq_map_size, PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_SQ_RING);
+  r->cq_map = single || r->sq_map == MAP_FAILED
+                  ? r->sq_map
+                  : mmap(NULL, r->cq_map_size, PROT_READ | PROT_WRITE,
+                         MAP_SHARED | MAP_POPULATE, r->fd, IORING_OFF_CQ_RING);
+  r->sqes = (struct io_uring_sqe *)mmap(NULL, r->sqes_size,
+                                        PROT_READ | PROT_WRITE,
+                                        MAP_SHARED | MAP_POPULATE, r->fd,
+                                        IORING_OFF_SQES);
+  if (r->sq_map == MAP_FAILED || r->cq_map == MAP_FAILED ||
+      r->sqes == MAP_FAILED) {
+    if (r->sqes != MAP_FAILED) {
+      munmap(r->sqes, r->sqes_size);
+    }
+    if (r->cq_map != MAP_FAILED && r->cq_map != r->sq_map) {
+      munmap(r->cq_map, r->cq_map_size);
+    }
+    if (r->sq_map != MAP_FAILED) {
+      munmap(r->sq_map, r->sq_map_size);
+    }
+    close(r->fd);
+    return false;
+  }
+  if (single) {
+    r->cq_map_size = 0; // Unmapped with the submission ring
+  }
+  uint8_t *sq = (uint8_t *)r->sq_map;
+  uint8_t *cq = (uint8_t *)r->cq_map;
+  r->sq_head = (_Atomic uint32_t *)(sq + p.sq_off.head);
+  r->sq_tail = (_Atomic uint32_t *)(sq + p.sq_off.tail);
+  r->sq_mask = (uint32_t *)(sq + p.sq_off.ring_mask);
+  r->sq_array = (uint32_t *)(sq + p.sq_off.array);
+  r->cq_head = (_Atomic uint32_t *)(cq + p.cq_off.head);
+  r->cq_tail = (_Atomic uint32_t *)(cq + p.cq_off.tail);
+  r->cq_mask = (uint32_t *)(cq + p.cq_off.ring_mask);
+  r->cqes = (struct io_uring_cqe *)(cq + p.cq_off.cqes);
+
+  struct iovec *iov = (struct iovec *)malloc(in->depth * sizeof(struct iovec));
+  for (uint32_t i = 0; iov && i < in->depth; i += 1) {
+    iov[i].iov_base = in->slots[i].buf;
+    iov[i].iov_len = in->block;
+  }
+  r->fixed = iov && syscall(__NR_io_uring_register, r->fd,
+                            IORING_REGISTER_BUFFERS, iov, in->depth) == 0;
+  free(iov);
+  return true;
+}
+
+// Unmaps the rings of the io_uring of the Input and closes it
+static void ring_delete(Input *in) {
+  Ring *r = &in->ring;
+  munmap(r->sqes, r->sqes_size);
+  if (r->cq_map_size) {
+    munmap(r->cq_map, r->cq_map_size);
+  }
+  munmap(r->sq_map, r->sq_map_size);
+  close(r->fd);
+}
+
+// Queues a read that fills the slot i from where it was left. The kernel
+// isn't told until ring_enter.
+static void ring_queue(Input *in, uint32_t i) {
+  Ring *r = &in->ring;
+  Slot *s = &in->slots[i];
+  uint32_t tail = atomic_load_explicit(r->sq_tail, memory_order_relaxed);
+  uint32_t index = tail & *r->sq_mask;
+  struct io_uring_sqe *sqe = &r->sqes[index];
+  memset(sqe, 0, sizeof(struct io_uring_sqe));
+  sqe->opcode = r->fixed ? IORING_OP_READ_FIXED : IORING_OP_READ;
+  sqe->fd = in->fd;
+  sqe->addr = (uint64_t)(uintptr_t)(s->buf + s->n);
+  sqe->len = in->block - s->n;
+  // A pipe is read from where it is, a file from the offset of the block
+  sqe->off = in->seekable ? s->offset + s->n : (uint64_t)-1;
+  sqe->buf_index = i;
+  sqe->user_data = i;
+  r->sq_array[index] = index;
+  atomic_store_explicit(r->sq_tail, tail + 1, memory_order_release);
+  s->busy = true;
+  in->in_flight += 1;
+}
+
+// Hands the queued reads the kernel didn't take yet to it, and waits until at
+// least wait reads completed. The kernel stops taking reads at one it
+// rejects, so some may be left over from the last call. Returns false if
+// io_uring_enter failed.
+static bool ring_enter(Input *in, uint32_t wait) {
+  Ring *r = &in->ring;
+  while (true) {
+    uint32_t to_submit =
+        atomic_load_explicit(r->sq_tail, memory_order_relaxed) -
+        atomic_load_explicit(r->sq_head, memory_order_acquire);
+    if (syscall(__NR_io_uring_enter, r->fd, to_submit, wait,
+                wait ? IORING_ENTER_GETEVENTS : 0, NULL, 0) >= 0) {
+      return true;
+    }
+    if (errno != EINTR) {
+      return false;
+    }
+  }
+}
+
+// Takes the completed reads off the completion ring. A read of a file that
+// stopped short is queued again for the rest of its block (the kernel may
+// split a read). A read that fails ends the input as failed, unless it is the
+// first one and the engine may fall back to read(2): then it is rejected.
+// Returns the number of reads that were queued again.
+static uint32_t ring_reap(Input *in) {
+  Ring *r = &in->ring;
+  uint32_t requeued = 0;
+  uint32_t head = atomic_load_explicit(r->cq_head, memory_order_relaxed);
+  while (head != atomic_load_explicit(r->cq_tail, memory_order_acquire)) {
+    struct io_uring_cqe *cqe = &r->cqes[head & *r->cq_mask];
+    uint32_t i = cqe->user_data;
+    int32_t res = cqe->res;
+    head += 1;
+    Slot *s = &in->slots[i];
+    s->busy = false;
+    in->in_flight -= 1;
+    if (res == -EINTR || res == -EAGAIN) {
+      ring_queue(in, i);
+      requeued += 1;
+    } else if (res < 0 && in->fallback && !in->read_any) {
+      in->rejected = true;
+    } else if (res <= 0) {
+      s->done = s->eof = true; // The end of the input, or it can't be read
+      in->eof = true;
+      in->failed = res < 0;
+    } else {
+      in->read_any = true;
+      s->n += res;
+      if (in->seekable && s->n < in->block) {
+        ring_queue(in, i);
+        requeued += 1;
+      } else {
+        s->done = true;
+      }
+    }
+  }
+  atomic_store_explicit(r->cq_head, head, memory_order_release);
+  return requeued;
+}
+
+// Fills the slot i with read(2), like a read of the io_uring would: until the
+// block is full or the input ends for a file, with whatever is there for a
+// pipe
+static void read_slot(Input *in, uint32_t i) {
+  Slot *s = &in->slots[i];
+  while (!s->done) {
+    ssize_t res = read(in->fd, s->buf + s->n, in->block - s->n);
+    if (res < 0 && errno == EINTR) {
+      continue;
+    }
+    if (res <= 0) {
+      s->done = s->eof = true;
+      in->eof = true;
+      in->failed = res < 0;
+    } else {
+      s->n += res;
+      s->done = !in->seekable || s->n == in->block;
+    }
+  }
+}
+
+// Hands the next blocks to the engine, as long as their slots are free: the
+// slot of the block that is being read isn't until the next one is taken, and
+// a pipe only has one read in flight at a time (so does a file, until a read
+// of the ring went through, if the engine may still fall back to read(2)).
+// Reads already queued (count of them) are submitted along.
+static void submit(Input *in, uint32_t queued) {
+  bool ahead = in->seekable && (in->read_any || !in->fallback);
+  while (!in->eof && in->submitted < in->delivered + in->depth - 1 &&
+         (ahead || in->in_flight == 0)) {
+    uint32_t i = in->submitted % in->depth;
+    Slot *s = &in->slots[i];
+    s->n = 0;
+    s->done = s->eof = false;
+    if (in->submitted == 0) { // The bytes read to tell the format come first
+      memcpy(s->buf, in->head, in->n_head);
+      s->n = in->n_head;
+    }
+    s->offset = in->offset;
+    in->offset += in->block;
+    in->submitted += 1;
+    if (in->engine == INPUT_URING) {
+      ring_queue(in, i);
+      queued += 1;
+    } else {
+      break; // read(2) fills it when it is needed
+    }
+  }
+  if (queued > 0 && !ring_enter(in, 0)) {
+    in->eof = in->failed = true;
+  }
+}
+
+// Goes on with read(2) once the first read of the io_uring was rejected. It
+// was the only read in flight, so the ring is closed and the blocks it was
+// given are read again from their start: nothing was read into them, and
+// read(2) reads from where the input was before them.
+static void fall_back(Input *in) {
+  ring_delete(in);
+  in->engine = INPUT_READ;
+  for (uint64_t b = in->delivered; b < in->submitted; b += 1) {
+    Slot *s = &in->slots[b % in->depth];
+    s->n = b == 0 ? in->n_head : 0;
+    s->busy = s->done = s->eof = false;
+  }
+}
+
+// The decoder thread. Decompresses the input into the free blocks, in order,
+// until it ends or the Input is deleted. The block the reader is on and those
+// it wasn't handed yet aren't free.
+static void *decode(void *arg) {
+  Input *in = (Input *)arg;
+  pthread_mutex_lock(&in->lock);
+  while (!in->stop && !in->eof) {
+    while (!in->stop && in->submitted >= in->delivered + in->depth - 1) {
+      pthread_cond_wait(&in->freed, &in->lock);
+    }
+    if (in->stop) {
+      break;
+    }
+    Slot *s = &in->slots[in->submitted % in->depth];
+    pthread_mutex_unlock(&in->lock);
+    s->n = decoder_read(in->decoder, s->buf, in->block);
+    pthread_mutex_lock(&in->lock);
+    s->done = true;
+    if (s->n < in->block) {
+      s->eof = in->eof = true;
+      in->failed = decoder_failed(in->decoder);
+    }
+    in->submitted += 1;
+    pthread_cond_broadcast(&in->filled);
+  }
+  pthread_mutex_unlock(&in->lock);
+  return NULL;
+}
+
+// Like next_block, for a compressed input: takes the next block from the
+// decoder thread, and gives it back the one that was read until now
+static bool next_decoded(Input *in) {
+  pthread_mutex_lock(&in->lock);
+  if (in->delivered == in->submitted && !in->eof) {
+    in->waits += 1;
+  }
+  while (in->delivered == in->submitted && !in->eof) {
+    pthread_cond_wait(&in->filled, &in->lock);
+  }
+  if (in->delivered == in->submitted) {
+    pthread_mutex_unlock(&in->lock);
+    return false;
+  }
+  Slot *s = &in->slots[in->delivered % in->depth];
+  in->delivered += 1;
+  pthread_cond_broadcast(&in->freed);
+  pthread_mutex_unlock(&in->lock);
+  in->data = s->buf;
+  in->n = s->n;
+  in->pos = 0;
+  return s->n > 0;
+}
+
+// Makes the next block of the input the one that is read. The block that was
+// read until now is given back to the engine to read ahead into. Returns
+// false once the input ended.
+static bool next_block(Input *in) {
+  if (in->decoder) {
+    in->ended = !next_decoded(in);
+    return !in->ended;
+  }
+  submit(in, 0);
+  if (in->delivered == in->submitted) {
+    in->ended = true; // Nothing more was submitted, so the input ended
+    return false;
+  }
+  uint32_t i = in->delivered % in->depth;
+  Slot *s = &in->slots[i];
+  if (!s->done) {
+    in->waits += 1;
+  }
+  while (!s->done) {
+    if (in->engine == INPUT_URING) {
+      ring_reap(in);
+      if (in->rejected) {
+        fall_back(in);
+      } else if (!s->done && !ring_enter(in, s->busy ? 1 : 0)) {
+        s->done = s->eof = in->eof = in->failed = true;
+      }
+    } else {
+      read_slot(in, i);
+    }
+  }
+  in->delivered += 1;
+  in->data = s->buf;
+  in->n = s->n;
+  in->pos = 0;
+  if (in->engine == INPUT_URING) {
+    uint32_t requeued = ring_reap(in);
+    if (in->rejected) {
+      fall_back(in);
+    } else {
+      submit(in, requeued);
+    }
+  }
+  in->ended = s->n == 0;
+  return !in->ended;
+}
+
+// Reads the first bytes of the input into the head of the Input, and tells
+// its format from them. A compressed input gets a Decoder and its thread
+// (reading with read(2)), unless it can't be decompressed: then it is read as
+// it is, and input_format tells why. Returns false if the thread couldn't be
+// started.
+static bool detect(Input *in) {
+  while (in->n_head < DECOMP_MAGIC) {
+    ssize_t r = read(in->fd, in->head + in->n_head, DECOMP_MAGIC - in->n_head);
+    if (r < 0 && errno == EINTR) {
+      continue;
+    }
+    if (r <= 0) {
+      break;
+    }
+    in->n_head += r;
+  }
+  in->format = decomp_detect(in->head, in->n_head);
+  if (in->format == DECOMP_NONE || !decomp_supported(in->format)) {
+    return true;
+  }
+  in->decoder = decoder_create(in->fd, in->format, in->head, in->n_head);
+  if (in->decoder == NULL) {
+    return false;
+  }
+  in->engine = INPUT_READ;
+  in->seekable = false;
+  pthread_mutex_init(&in->lock, NULL);
+  pthread_cond_init(&in->filled, NULL);
+  pthread_cond_init(&in->freed, NULL);
+  in->threaded = pthread_create(&in->thread, NULL, decode, in) == 0;
+  return in->threaded;
+}
+
+// The constructor for an Input. Reads fd with the engine (INPUT_READ,
+// INPUT_URING, or INPUT_AUTO for io_uring if the kernel has it and read(2)
+// otherwise) into depth blocks of block bytes, all allocated here. The reads
+// start right away, so the first blocks are in by the time they are needed.
+// If the input is gzip or zstd compressed, it is decompressed by a thread of
+// its own instead, ahead of the reader.
+// Returns NULL if the memory couldn't be allocated, io_uring was asked for
+// and isn't available, or the decoder couldn't be started.
+Input *input_create(int fd, uint32_t engine, uint32_t depth, uint64_t block) {
+  if (engine == INPUT_STDIO || engine > INPUT_AUTO || depth < 2) {
+    return NULL;
+  }
+  Input *in = (Input *)calloc(1, sizeof(Input));
+  if (in == NULL) {
+    return NULL;
+  }
+  in->fd = fd;
+  in->depth = depth;
+  in->block = block;
+  struct stat st;
+  off_t at = lseek(fd, 0, SEEK_CUR);
+  in->seekable = fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && at >= 0;
+  in->offset = in->seekable ? at : 0;
+  in->slots = (Slot *)calloc(depth, sizeof(Slot));
+  bool ok = in->slots != NULL;
+  for (uint32_t i = 0; ok && i < depth; i += 1) {
+    in->slots[i].buf = (char *)aligned_alloc(INPUT_ALIGN, block);
+    ok = in->slots[i].buf != NULL;
+  }
+  in->engine = engine == INPUT_AUTO ? INPUT_URING : engine;
+  in->fallback = engine == INPUT_AUTO;
+  if (ok && !detect(in)) {
+    ok = false;
+    in->engine = INPUT_READ;
+  }
+  if (ok && in->engine == INPUT_URING && !ring_setup(in)) {
+    in->engine = INPUT_READ;
+    ok = engine == INPUT_AUTO;
+  }
+  if (!ok) {
+    in->engine = INPUT_READ; // The ring wasn't set up
+    input_delete(&in);
+    return NULL;
+  }
+  if (in->decoder == NULL) {
+    submit(in, 0);
+  }
+  return in;
+}
+
+// Reads the Input of a FILE made by input_stdio. Like read(2), it returns
+// what the current block has rather than wait for n bytes, so a line from a
+// pipe is scanned as soon as it arrives. A read that failed is an error of
+// the FILE.
+static ssize_t cookie_read(void *cookie, char *buf, size_t n) {
+  Input *in = (Input *)cookie;
+  if (in->pos == in->n && !next_block(in)) {
+    return input_failed(in) ? -1 : 0;
+  }
+  uint64_t size = in->n - in->pos;
+  size = size < n ? size : n;
+  memcpy(buf, in->data + in->pos, size);
+  in->pos += size;
+  return (ssize_t)size;
+}
+
+// Deletes the Input of a FILE made by input_stdio once it is closed
+static int cookie_close(void *cookie) {
+  Input *in = (Input *)cookie;
+  input_delete(&in);
+  return 0;
+}
+
+// Opens fd for the stdio engine, which still decompresses gzip and zstd
+// input. Its first bytes are looked at to tell its format: if it is
+// compressed, the Input that decompresses it (like input_create with
+// INPUT_READ) is returned. Else NULL is returned, and f is set to the FILE it
+// is read with: f itself if the bytes could be looked at without reading them
+// (a regular file), or a FILE that reads them back before the rest of fd
+// (through an Input). f is set to NULL if fd couldn't be opened.
+Input *input_stdio(int fd, FILE **f, uint32_t depth, uint64_t block) {
+  struct stat st;
+  off_t at = lseek(fd, 0, SEEK_CUR);
+  if (fstat(fd, &st) == 0 && S_ISREG(st.st_mode) && at >= 0) {
+    char head[DECOMP_MAGIC];
+    ssize_t n = pread(fd, head, DECOMP_MAGIC, at);
+    if (n <= 0 || decomp_detect(head, n) == DECOMP_NONE) {
+      return NULL;
+    }
+  }
+  Input *in = input_create(fd, INPUT_READ, depth, block);
+  if (in == NULL || in->format != DECOMP_NONE) {
+    *f = in ? *f : NULL;
+    return in;
+  }
+  cookie_io_functions_t io = {cookie_read, NULL, NULL, cookie_close};
+  *f = fopencookie(in, "r", io);
+  if (*f == NULL) {
+    input_delete(&in);
+  }
+  return NULL;
+}
+
+// The destructor for an Input. Waits for the reads in flight, since the
+// kernel (or the decoder thread) writes into the blocks, then frees them. fd
+// isn't closed.
+void input_delete(Input **in) {
+  if (*in) {
+    Input *p = *in;
+    if (p->threaded) {
+      pthread_mutex_lock(&p->lock);
+      p->stop = true;
+      pthread_cond_broadcast(&p->freed);
+      pthread_mutex_unlock(&p->lock);
+      pthread_join(p->thread, NULL);
+    }
+    if (p->decoder) {
+      decoder_delete(&p->decoder);
+      pthread_cond_destroy(&p->freed);
+      pthread_cond_destroy(&p->filled);
+      pthread_mutex_destroy(&p->lock);
+    }
+    if (p->engine == INPUT_URING) {
+      while (p->in_flight > 0) {
+        p->eof = true; // Nothing is read again
+        ring_reap(p);
+        if (p->in_flight > 0 && !ring_enter(p, 1)) {
+          break;
+        }
+      }
+      ring_delete(p);
+    }
+    if (p->seekable && p->delivered > 0) {
+      // Leaves fd where the reader stopped, like stdio would
+      lseek(p->fd, p->slots[(p->delivered - 1) % p->depth].offset + p->pos,
+            SEEK_SET);
+    }
+    for (uint32_t i = 0; p->slots && i < p->depth; i += 1) {
+      free(p->slots[i].buf);
+    }
+    free(p->slots);
+    free(p);
+    *in = NULL;
+  }
+}
+
+// Copies the next n bytes of the input into buf, like fread. Returns the
+// number of bytes copied, which is less than n only at the end of the input.
+uint64_t input_read(Input *in, char *buf, uint64_t n) {
+  uint64_t copied = 0;
+  while (copied < n) {
+    if (in->pos == in->n && !next_block(in)) {
+      break;
+    }
+    uint64_t size = in->n - in->pos;
+    size = size < n - copied ? size : n - copied;
+    memcpy(buf + copied, in->data + in->pos, size);
+    in->pos += size;
+    copied += size;
+  }
+  return copied;
+}
+
+// Copies the next line of the input into buf, like fgets: at most size - 1
+// bytes, up to and including the newline, followed by a '\0'. Sets len to the
+// number of bytes copied. Returns NULL if the input ended before anything
+// could be copied.
+char *input_gets(Input *in, char *buf, uint32_t size, uint32_t *len) {
+  uint32_t copied = 0;
+  bool line = false;
+  while (!line && copied + 1 < size) {
+    if (in->pos == in->n && !next_block(in)) {
+      break;
+    }
+    uint64_t room = size - 1 - copied;
+    uint64_t left = in->n - in->pos;
+    uint64_t take = left < room ? left : room;
+    char *nl = (char *)memchr(in->data + in->pos, '\n', take);
+    if (nl) {
+      take = nl - (in->data + in->pos) + 1;
+      line = true;
+    }
+    memcpy(buf + copied, in->data + in->pos, take);
+    in->pos += take;
+    copied += take;
+  }
+  if (copied == 0) {
+    return NULL;
+  }
+  buf[copied] = '\0';
+  *len = copied;
+  return buf;
+}
+
+// Returns true once a read got to the end of the input, like feof
+bool input_eof(Input *in) { return in->ended; }
+
+// Returns the format of the input (DECOMP_NONE if it isn't compressed). If it
+// isn't supported by this build, the input is read as it is.
+uint32_t input_format(Input *in) { return in->format; }
+
+// Returns true if the input couldn't be read to its end: a read failed, or it
+// couldn't be decompressed (it is corrupt or was cut short), so only the start
+// of it was read
+bool input_failed(Input *in) {
+  if (in->decoder == NULL) {
+    return in->failed;
+  }
+  pthread_mutex_lock(&in->lock);
+  bool failed = in->failed;
+  pthread_mutex_unlock(&in->lock);
+  return failed;
+}
+
+// Returns the engine the Input reads with (INPUT_AUTO was resolved)
+uint32_t input_engine(Input *in) { return in->engine; }
+
+// Returns the number of blocks the reader had to wait for, because they were
+// not read yet when the previous one was done. Every block read with read(2)
+// is waited for.
+uint64_t input_waits(Input *in) { return in->waits; }
+
+// Returns the name of an engine
+const char *input_engine_name(uint32_t engine) {
+  return engine <= INPUT_AUTO ? engine_names[engine] : "unknown";
+}
+
+// Returns the engine with the given name, or UINT32_MAX if the name isn't
+// known
+uint32_t input_engine_parse(const char *name) {
+  for (uint32_t i = 0; i <= INPUT_AUTO; i += 1) {
+    if (strcmp(name, engine_names[i]) == 0) {
+      return i;
+    }
+  }
+  return UINT32_MAX;
+}
@@ -0,0 +1,47 @@
+#ifndef __INPUT_H__
+#define __INPUT_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// Engines that read the input: the stdio calls of the Parser (no Input at
+// all, unless the input is compressed), read(2) into the blocks, or io_uring
+// with the next blocks in flight while the current one is scanned. auto picks
+// io_uring if the kernel has it.
+#define INPUT_STDIO 0
+#define INPUT_READ  1
+#define INPUT_URING 2
+#define INPUT_AUTO  3
+
+// Size and number of the blocks of an Input
+#define INPUT_BLOCK (1 << 18)
+#define INPUT_DEPTH 4
+
+typedef struct Input Input;
+
+Input *input_create(int fd, uint32_t engine, uint32_t depth, uint64_t block);
+
+Input *input_stdio(int fd, FILE **f, uint32_t depth, uint64_t block);
+
+void input_delete(Input **in);
+
+uint64_t input_read(Input *in, char *buf, uint64_t n);
+
+char *input_gets(Input *in, char *buf, uint32_t size, uint32_t *len);
+
+bool input_eof(Input *in);
+
+uint32_t input_format(Input *in);
+
+bool input_failed(Input *in);
+
+uint32_t input_engine(Input *in);
+
+uint64_t input_waits(Input *in);
+
+const char *input_engine_name(uint32_t engine);
+
+uint32_t input_engine_parse(const char *name);
+
+#endif
@@ -8,49 +8,11 @@
 uint64_t seeks; // Number of seeks performed.
 uint64_t links; // Number of links traversed.
 
-// Returns the length of a list.
-// The argument is a pointer to the array of characters.
-uint64_t my_strlens(char *s) {
-  if (s) { // If the string exists
-    char c = s[0];
-    uint64_t count = 0;
-    for (uint64_t i = 0; c != '\0';
-         i += 1) { // Go throgh the list, stopping at \0
-      c = s[i];
-      if (c == '\0') {
-        break;
-      }
-      count += 1;
-    }
-    return count;
-  }
-  return 0;
-}
-
-// Returns 'true' if the two string arguments are the same, and 'false' if they
-// are different.
-bool my_strcmp(char *s, char *s1) {
-  if (s != NULL & s1 != NULL) {
-    uint64_t l = my_strlens(s);
-    uint64_t l1 = my_strlens(s1);
-    if (l != l1) {
-      return false;
-    } else {
-      for (uint64_t i = 0; i < l; i += 1) {
-        if (s[i] != s1[i]) {
-          return false;
-        }
-      }
-      return true;
-    }
-  }
-  return false;
-}
-
 // Defines what members/fields the LinkedList structure has.
 // The length is the size or the number of nodes.
 // Head and Tail are sentinel nodes that signal the beginning and end of the
 // linked list mtf enables the move-to-front feature
+// arena (if not NULL) holds the strings of the nodes that don't fit inline
 typedef struct LinkedList LinkedList;
 
 struct LinkedList {
@@ -58,21 +20,24 @@ struct LinkedList {
   Node *head; // Head sentinel node.
   Node *tail; // Tail sentinel node.
   bool mtf;
+  Arena *arena;
 };
 
 // The constructor for the LinkedList. Creates a new LinkedList and returns a
 // pointer to it if the memory was allocated succesfully. Else, return NULL.
-// Takes a bool mtf that sets the mtf member to it.
-LinkedList *ll_create(bool mtf) {
+// Takes a bool mtf that sets the mtf member to it, and the arena that the
+// strings of its nodes are copied into (NULL to malloc each one).
+LinkedList *ll_create(bool mtf, Arena *arena) {
   LinkedList *ll = (LinkedList *)malloc(sizeof(LinkedList));
   // If the memory was allocated, set the members of the LinkedList
   if (ll) {
-    ll->head = node_create(NULL, NULL); // Create nodes and set it to NULL
-    ll->tail = node_create(NULL, NULL);
+    ll->head = node_create(NULL, NULL, NULL); // Create nodes and set it to NULL
+    ll->tail = node_create(NULL, NULL, NULL);
     ll->length = 0;            // length starts with 0
     ll->tail->prev = ll->head; // format: head points at tail
     ll->head->next = ll->tail;
     ll->mtf = mtf;
+    ll->arena = arena;
   }
   // Return the new LinkedList
   return ll;
@@ -98,49 +63,174 @@ void ll_delete(LinkedList **ll) {
 // Returns the length of the Linked List
 uint32_t ll_length(LinkedList *ll) { return ll->length; }
 
-// Searches for a node that has a specific oldspeak word.
-// If it founds, return a pointer to it. Else, return NULL
-Node *ll_lookup(LinkedList *ll, char *oldspeak) {
-  // If the link is not empty
-  seeks += 1;
-  if (ll->head->next != ll->tail) {
-    Node *temp = ll->head;
-    // Go through all nodes in the list
-    // Stop when the next node is the tail
-    while (temp->next != ll->tail) {
-      links += 1;
-      // connects temp
-      Node *n = temp;
-      temp = temp->next;
-      temp->prev = n;
-      // Checks for oldspeak
-      if (my_strcmp(temp->oldspeak, oldspeak) == true) {
-        if (ll->mtf) {
-          // makes sure all nodes are connected
-          temp->prev->next = temp->next;
-          temp->next->prev = temp->prev;
-          // move the node to the front
-          temp->next = ll->head->next;
-          temp->prev = ll->head;
-          ll->head->next = temp;
-        }
-        return temp;
+// Deletes every node of the list, leaving it empty. Nodes that live in an
+// arena are only unlinked; they are freed with the arena.
+void ll_clear(LinkedList *ll) {
+  Node *n = ll->head->next;
+  while (n != ll->tail) {
+    Node *next = n->next;
+    node_delete(&n);
+    n = next;
+  }
+  ll->head->next = ll->tail;
+  ll->tail->prev = ll->head;
+  ll->length = 0;
+}
+
+// Returns true if the node holds the oldspeak word with the given length and
+// fingerprint. Nodes with a different length or fingerprint are rejected
+// without touching the strings.
+static inline bool node_matches(Node *n, char *oldspeak, uint32_t len,
+                                uint32_t fp) {
+  return n->fp == fp && n->len == len && node_key_equals(n, oldspeak, len);
+}
+
+// Walks the list looking for the node that has the given oldspeak word.
+// The number of nodes visited is added to *n_links. If mtf is true the node
+// found is moved to the front of the list. Else, the list is not written to.
+static Node *find(LinkedList *ll, char *oldspeak, uint32_t len, uint32_t fp,
+                  bool mtf, uint64_t *n_links) {
+  Node *temp = ll->head->next;
+  // Stop when we get to the tail
+  while (temp != ll->tail) {
+    *n_links += 1;
+    // Checks for oldspeak
+    if (node_matches(temp, oldspeak, len, fp)) {
+      if (mtf && temp->prev != ll->head) {
+        // makes sure all nodes are connected
+        temp->prev->next = temp->next;
+        temp->next->prev = temp->prev;
+        // move the node to the front
+        temp->next = ll->head->next;
+        temp->prev = ll->head;
+        ll->head->next->prev = temp;
+        ll->head->next = temp;
       }
+      return temp;
     }
+    temp = temp->next;
   }
   return NULL;
 }
 
+// Searches for a node that has a specific oldspeak word.
+// len is the length of oldspeak and fp its fingerprint. oldspeak has to be
+// zero padded to NODE_INLINE bytes.
+// If it founds, return a pointer to it. Else, return NULL
+Node *ll_lookup(LinkedList *ll, char *oldspeak, uint32_t len, uint32_t fp) {
+  seeks += 1;
+  return find(ll, oldspeak, len, fp, ll->mtf, &links);
+}
+
+// Same as ll_lookup, but never writes to the list or to the global stats, so
+// many threads can call it on the same list at once. Move-to-front is skipped
+// and the number of nodes visited is added to *n_links instead.
+Node *ll_lookup_r(LinkedList *ll, char *oldspeak, uint32_t len, uint32_t fp,
+                  uint64_t *n_links) {
+  return find(ll, oldspeak, len, fp, false, n_links);
+}
+
 // Inserts a new node into the list that has the given oldspeak and newspeak
-void ll_insert(LinkedList *ll, char *oldspeak, char *newspeak) {
-  if (ll_lookup(ll, oldspeak) == NULL) { // oldspeak isn't already in the list
-    Node *n = node_create(oldspeak, newspeak); // Creating a new node
+// len is the length of oldspeak and fp its fingerprint.
+void ll_insert(LinkedList *ll, char *oldspeak, char *newspeak, uint32_t len,
+               uint32_t fp) {
+  // oldspeak isn't already in the list
+  // (the search is not counted in the global stats)
+  uint64_t n_links = 0;
+  if (find(ll, oldspeak, len, fp, ll->mtf, &n_links) == NULL) {
+    Node *n = node_create(oldspeak, newspeak, ll->arena); // Creating a new node
+    n->fp = fp;
     // Puts node at the beginning of the list
-    n->next = ll->head->next;
-    n->prev = ll->head;
-    // Changes head to point at the new node
-    ll->head->next = n;
-    ll->length += 1;
+    ll_push(ll, n);
+  }
+}
+
+// Inserts every node of src into dst, oldest first, so that dst ends up as if
+// the words of src had been inserted into it directly after its own.
+void ll_merge(LinkedList *dst, LinkedList *src) {
+  for (Node *n = src->tail->prev; n != src->head; n = n->prev) {
+    ll_insert(dst, n->oldspeak, n->newspeak, n->len, n->fp);
+  }
+}
+
+// Like ll_merge, but the nodes of src are moved instead of copied: those whose
+// oldspeak isn't in dst yet are unlinked from src and put at the beginning of
+// dst, oldest first. They stay in the arena of src, which has to live as long
+// as dst. The global stats aren't written to, so threads can move nodes
+// between different lists at once. Returns the number of nodes moved.
+uint32_t ll_move(LinkedList *dst, LinkedList *src) {
+  uint32_t moved = 0;
+  uint64_t n_links = 0;
+  Node *n = src->tail->prev;
+  while (n != src->head) {
+    Node *prev = n->prev;
+    if (find(dst, n->oldspeak, n->len, n->fp, dst->mtf, &n_links) == NULL) {
+      prev->next = n->next;
+      n->next->prev = prev;
+      src->length -= 1;
+      ll_push(dst, n);
+      moved += 1;
+    }
+    n = prev;
+  }
+  return moved;
+}
+
+// Removes the node that has the given oldspeak from the list, if there is one.
+// len is the length of oldspeak and fp its fingerprint.
+// Returns true if a node was removed.
+bool ll_remove(LinkedList *ll, char *oldspeak, uint32_t len, uint32_t fp) {
+  Node *prev = ll->head;
+  // Go through all nodes in the list, keeping track of the previous one
+  while (prev->next != ll->tail) {
+    Node *temp = prev->next;
+    if (node_matches(temp, oldspeak, len, fp)) {
+      // Unlink the node and free it
+      prev->next = temp->next;
+      temp->next->prev = prev;
+      node_delete(&temp);
+      ll->length -= 1;
+      return true;
+    }
+    prev = temp;
+  }
+  return false;
+}
+
+// Unlinks the first node of the list and returns it (NULL if the list is
+// empty). The node is not freed, so it can be moved to another list.
+Node *ll_pop(LinkedList *ll) {
+  Node *n = ll->head->next;
+  if (n == ll->tail) {
+    return NULL;
+  }
+  ll->head->next = n->next;
+  n->next->prev = ll->head;
+  ll->length -= 1;
+  return n;
+}
+
+// Puts a node that was taken out of a list with ll_pop at the beginning of
+// the list. The list has to use the same arena as the one it came from.
+void ll_push(LinkedList *ll, Node *n) {
+  n->next = ll->head->next;
+  n->prev = ll->head;
+  ll->head->next->prev = n;
+  ll->head->next = n;
+  ll->length += 1;
+}
+
+// Calls fn with every node of the LinkedList (and arg), from the head to the
+// tail. The next node is taken before fn is called, so fn may remove the node
+// it is given.
+void ll_for_each(LinkedList *ll, void (*fn)(Node *n, void *arg), void *arg) {
+  if (ll) {
+    Node *n = ll->head->next;
+    while (n != ll->tail) {
+      Node *next = n->next;
+      fn(n, arg);
+      n = next;
+    }
   }
 }
 
@@ -160,7 +250,7 @@ void ll_print(LinkedList *ll) {
 }
 
 // Sets the stats (seeks and links)
-void ll_stats(uint32_t *n_seeks, uint32_t *n_links) {
+void ll_stats(uint64_t *n_seeks, uint64_t *n_links) {
   *n_seeks = seeks;
   *n_links = links;
 }
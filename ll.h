@@ -8,18 +8,36 @@
 
 typedef struct LinkedList LinkedList;
 
-LinkedList *ll_create(bool mtf);
+LinkedList *ll_create(bool mtf, Arena *arena);
 
 void ll_delete(LinkedList **ll);
 
 uint32_t ll_length(LinkedList *ll);
 
-Node *ll_lookup(LinkedList *ll, char *oldspeak);
+void ll_clear(LinkedList *ll);
 
-void ll_insert(LinkedList *ll, char *oldspeak, char *newspeak);
+Node *ll_lookup(LinkedList *ll, char *oldspeak, uint32_t len, uint32_t fp);
+
+Node *ll_lookup_r(LinkedList *ll, char *oldspeak, uint32_t len, uint32_t fp,
+                  uint64_t *n_links);
+
+void ll_insert(LinkedList *ll, char *oldspeak, char *newspeak, uint32_t len,
+               uint32_t fp);
+
+void ll_merge(LinkedList *dst, LinkedList *src);
+
+uint32_t ll_move(LinkedList *dst, LinkedList *src);
+
+bool ll_remove(LinkedList *ll, char *oldspeak, uint32_t len, uint32_t fp);
+
+Node *ll_pop(LinkedList *ll);
+
+void ll_push(LinkedList *ll, Node *n);
+
+void ll_for_each(LinkedList *ll, void (*fn)(Node *n, void *arg), void *arg);
 
 void ll_print(LinkedList *ll);
 
-void ll_stats(uint32_t *n_seeks, uint32_t *n_links);
+void ll_stats(uint64_t *n_seeks, uint64_t *n_links);
 
 #endif
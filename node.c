@@ -49,14 +49,36 @@ char *my_strdup(char *s) {
 // The constructor for a Node. Creates a new Node and returns a pointer to it if
 // the memory was allocated succesfully. Else, return NULL Oldspeak and
 // newspeak. are strings that represent words Next holds the address of the next
-// node, while prev holds the previous node.
-Node *node_create(char *oldspeak, char *newspeak) {
+// node, while prev holds the previous node. len is the length of oldspeak and
+// fp is a fingerprint of it, set by whoever hashes the node's key.
+// An oldspeak shorter than NODE_INLINE is kept (zero padded) in key. Longer
+// ones, and the newspeak, are copied into the arena, or with my_strdup if
+// arena is NULL. If there is an arena, the Node itself is allocated from it.
+Node *node_create(char *oldspeak, char *newspeak, Arena *arena) {
   // Allocates memory for the new Node
-  Node *n = (Node *)malloc(sizeof(Node));
+  Node *n = arena ? (Node *)arena_alloc(arena, sizeof(Node))
+                  : (Node *)malloc(sizeof(Node));
   // If the memory was allocated, set the members of it
   if (n) {
-    n->oldspeak = my_strdup(oldspeak);
-    n->newspeak = my_strdup(newspeak);
+    n->len = my_strlen(oldspeak);
+    n->fp = 0;
+    n->owned = arena == NULL;
+    memset(n->key, 0, sizeof(n->key));
+    if (oldspeak == NULL) {
+      n->oldspeak = NULL;
+    } else if (n->len < NODE_INLINE) {
+      memcpy(n->key, oldspeak, n->len);
+      n->oldspeak = (char *)n->key;
+    } else if (arena) {
+      n->oldspeak = arena_strdup(arena, oldspeak, n->len);
+    } else {
+      n->oldspeak = my_strdup(oldspeak);
+    }
+    if (newspeak != NULL && arena) {
+      n->newspeak = arena_strdup(arena, newspeak, my_strlen(newspeak));
+    } else {
+      n->newspeak = my_strdup(newspeak);
+    }
     n->next = NULL;
     n->prev = NULL;
     return n;
@@ -65,13 +87,17 @@ Node *node_create(char *oldspeak, char *newspeak) {
 }
 
 // The destructor for a Node. Frees the pointer to the Node, and set it to NULL
+// Nodes that live in an arena (and their strings) are freed with the arena.
 void node_delete(Node **n) {
   if (*n) {
     // free badspeak and newspeak
-    free((*n)->oldspeak);
-    free((*n)->newspeak);
-    //    free(dup);
-    free(*n);
+    if ((*n)->owned) {
+      if ((*n)->oldspeak != (char *)(*n)->key) {
+        free((*n)->oldspeak);
+      }
+      free((*n)->newspeak);
+      free(*n);
+    }
     *n = NULL;
   }
 }
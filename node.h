@@ -1,19 +1,50 @@
 #ifndef __NODE_H__
 #define __NODE_H__
 
+#include "arena.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+// Keys shorter than NODE_INLINE bytes are stored in the node itself, zero
+// padded, so they compare as NODE_INLINE / 8 64-bit words.
+#define NODE_INLINE 24
+
 typedef struct Node Node;
 
 struct Node {
     char *oldspeak;
     char *newspeak;
+    uint32_t len;
+    uint32_t fp;
     Node *next;
     Node *prev;
+    bool owned;
+    uint64_t key[NODE_INLINE / 8];
 };
 
-Node *node_create(char *oldspeak, char *newspeak);
+Node *node_create(char *oldspeak, char *newspeak, Arena *arena);
 
 void node_delete(Node **n);
 
 void node_print(Node *n);
 
+// Returns true if the node's key is oldspeak, which has length len.
+// For short keys oldspeak must be zero padded to NODE_INLINE bytes (the way
+// next_word produces words) so the check is a few word compares with no
+// branches on the bytes.
+static inline bool node_key_equals(Node *n, char *oldspeak, uint32_t len) {
+  if (len < NODE_INLINE) {
+    uint64_t w[NODE_INLINE / 8];
+    memcpy(w, oldspeak, sizeof(w));
+    uint64_t diff = 0;
+    for (uint32_t i = 0; i < NODE_INLINE / 8; i += 1) {
+      diff |= n->key[i] ^ w[i];
+    }
+    return diff == 0;
+  }
+  return memcmp(n->oldspeak, oldspeak, len) == 0;
+}
+
 #endif
@@ -0,0 +1,149 @@
+#include "norm.h"
+#include "utf8.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+// Names of the kinds of normalization, in the order of their flags
+static const char *kind_names[] = {"leet", "diacritics", "confusables",
+                                   "ignorables"};
+
+// The leet substitutions: each byte of leet_from becomes the letter at the
+// same place in leet_to
+static const char leet_from[] = "013457@$";
+static const char leet_to[] = "oieaasts";
+
+// The normalization in use. It starts out off, so that words are only lower
+// cased until norm_init is called.
+Normalizer normalizer = {0, {0}};
+
+// Turns on the kinds of normalization in flags (and off the others), and
+// fills in the table of the ASCII bytes. Must be called before the
+// dictionary is loaded, so its words are normalized like the text.
+void norm_init(uint32_t flags) {
+  normalizer.flags = flags & NORM_ALL;
+  memset(normalizer.ascii, 0, sizeof(normalizer.ascii));
+  for (uint32_t c = 'a'; c <= 'z'; c += 1) {
+    normalizer.ascii[c] = c;
+    normalizer.ascii[c - 'a' + 'A'] = c;
+  }
+  for (uint32_t c = '0'; c <= '9'; c += 1) {
+    normalizer.ascii[c] = c;
+  }
+  normalizer.ascii['\''] = '\'';
+  normalizer.ascii['-'] = '-';
+  if (flags & NORM_LEET) {
+    for (uint32_t i = 0; leet_from[i] != '\0'; i += 1) {
+      normalizer.ascii[(uint8_t)leet_from[i]] = leet_to[i];
+    }
+  }
+}
+
+// Returns the flags named by list: "none", "all", or names of kinds
+// separated by commas (leet,diacritics,confusables,ignorables). Returns
+// UINT32_MAX if a name isn't known.
+uint32_t norm_parse(const char *list) {
+  if (strcmp(list, "none") == 0) {
+    return 0;
+  }
+  if (strcmp(list, "all") == 0) {
+    return NORM_ALL;
+  }
+  uint32_t flags = 0;
+  while (true) {
+    size_t len = strcspn(list, ",");
+    uint32_t i = 0;
+    while (i < 4 && (strlen(kind_names[i]) != len ||
+                     strncmp(list, kind_names[i], len) != 0)) {
+      i += 1;
+    }
+    if (i == 4) {
+      return UINT32_MAX;
+    }
+    flags |= 1 << i;
+    if (list[len] == '\0') {
+      return flags;
+    }
+    list += len + 1;
+  }
+}
+
+// Writes the names of the kinds in flags to buf (size bytes), separated by
+// commas, or "none" or "all"
+void norm_names(uint32_t flags, char *buf, size_t size) {
+  size_t n = 0;
+  buf[0] = '\0';
+  if (flags == NORM_ALL) {
+    snprintf(buf, size, "all");
+    return;
+  }
+  for (uint32_t i = 0; i < 4; i += 1) {
+    if ((flags & (1 << i)) && n < size) {
+      n += snprintf(buf + n, size - n, "%s%s", n ? "," : "", kind_names[i]);
+    }
+  }
+  if (n == 0) {
+    snprintf(buf, size, "none");
+  }
+}
+
+// The slow path of the tokenizer when normalization is on, for a character
+// the word_span kernel stops at. Copies the character at the start of s to
+// word, normalized and case folded, if it can be part of a word and fits in
+// room bytes: an ASCII byte through the ascii table (so @ and $ are letters
+// with leet), anything else through the Unicode tables. An ignorable or a
+// diacritical mark is removed instead, which still takes its bytes.
+// Returns the number of bytes of s it took (0 if it wasn't copied), and sets
+// n to the number of bytes written to word.
+uint32_t norm_word_char(const char *s, char *word, uint32_t room,
+                        uint32_t *n) {
+  uint32_t flags = normalizer.flags;
+  uint8_t b = (uint8_t)s[0];
+  if (b < 0x80) {
+    if (normalizer.ascii[b] == 0 || room == 0) {
+      return 0;
+    }
+    word[0] = normalizer.ascii[b];
+    *n = 1;
+    return 1;
+  }
+  uint32_t cp = 0;
+  uint32_t len = utf8_decode(s, &cp);
+  if (len == 0) {
+    return 0;
+  }
+  // Ignorables aren't word characters, but they don't end the word either
+  uint32_t e = utf8_norm(cp);
+  if ((e >> 24) == NORM_IGNORABLES && (flags & NORM_IGNORABLES)) {
+    *n = 0;
+    return len;
+  }
+  if (!utf8_word(cp)) {
+    return 0;
+  }
+  // What a code point becomes may be normalized again, by another kind
+  for (uint32_t i = 0; i < 3 && e != 0 && (flags & (e >> 24)); i += 1) {
+    cp = e & 0xffffff;
+    if (cp == 0) {
+      *n = 0;
+      return len;
+    }
+    e = utf8_norm(cp);
+  }
+  cp = utf8_fold(cp);
+  if (cp < 0x80) {
+    cp = normalizer.ascii[cp];
+    if (cp == 0) {
+      return 0;
+    }
+  }
+  char out[UTF8_MAX];
+  uint32_t k = utf8_encode(cp, out);
+  if (k > room) {
+    return 0;
+  }
+  memcpy(word, out, k);
+  *n = k;
+  return len;
+}
@@ -0,0 +1,37 @@
+#ifndef __NORM_H__
+#define __NORM_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Kinds of normalization the tokenizer can do to the words, each of which can
+// be turned on by itself
+#define NORM_LEET        1
+#define NORM_DIACRITICS  2
+#define NORM_CONFUSABLES 4
+#define NORM_IGNORABLES  8
+#define NORM_ALL         15
+
+// The normalization in use. flags are the NORM_ kinds that are on, and ascii
+// maps each ASCII byte to the byte it becomes in a word (lower case, and the
+// leet substitutions if NORM_LEET is on), or to 0 if it can't be in a word.
+// ascii is only filled in by norm_init, and only used if flags isn't 0.
+typedef struct Normalizer Normalizer;
+
+struct Normalizer {
+  uint32_t flags;
+  uint8_t ascii[256];
+};
+
+extern Normalizer normalizer;
+
+void norm_init(uint32_t flags);
+
+uint32_t norm_parse(const char *list);
+
+void norm_names(uint32_t flags, char *buf, size_t size);
+
+uint32_t norm_word_char(const char *s, char *word, uint32_t room, uint32_t *n);
+
+#endif
@@ -1,14 +1,15 @@
 #include "parser.h"
-#include <ctype.h>
+#include "cpu.h"
+#include "node.h"
+#include "norm.h"
+#include "prof.h"
+#include "utf8.h"
 #include <stdbool.h>
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
 #define MAX_PARSER_LINE_LENGTH 1000
 
-// The char c is used to hold the last character that was in NextWord.
-// This way, we could easily know when a line ends.
-char c = '\n';
-
 // My implementation of the strlen function from the string library.
 // Takes a string argument and returns its size.
 uint64_t mystrlens(char *s) {
@@ -66,15 +67,19 @@ void my_strcpy(char *s1, char *s) {
 }
 
 // Defines what members/fields the Parser structure has.
-// The f is the file it parses.
+// The f is the file it parses, or in the Input it reads it from instead.
 // Current line is a string that holds the current line of the file.
 // Line offset is used to check how much of the line was read already.
+// Bytes is the number of bytes read from the file so far.
+// The line has CPU_SPAN_PAD bytes of slack for the word_span kernel.
 typedef struct Parser Parser;
 
 struct Parser {
   FILE *f;
-  char current_line[MAX_PARSER_LINE_LENGTH + 1];
+  Input *in;
+  char current_line[MAX_PARSER_LINE_LENGTH + 1 + CPU_SPAN_PAD];
   uint32_t line_offset;
+  uint64_t bytes;
 };
 
 // The constructor for the Parser. Creates a new Parser and returns a
@@ -86,120 +91,188 @@ Parser *parser_create(FILE *f) {
   // If the memory was allocated, set the members of the Parser
   if (p != NULL) {
     p->f = f;
+    p->in = NULL;
     p->line_offset = 0;
+    p->bytes = 0;
+    p->current_line[0] = '\0'; // No line was read yet
   }
   // Returns the Parser
   return p;
 }
 
+// The constructor for a Parser that reads its lines from the Input in, which
+// it then owns, instead of a FILE. Returns NULL if the memory couldn't be
+// allocated.
+Parser *parser_create_input(Input *in) {
+  Parser *p = parser_create(NULL);
+  if (p != NULL) {
+    p->in = in;
+  }
+  return p;
+}
+
 // The destructor for a Parser.
-// Closes the file, frees the pointer to the Parser, and set it to NULL.
+// Closes the file (or deletes the Input), frees the pointer to the Parser,
+// and set it to NULL.
 void parser_delete(Parser **p) {
   if (*p) {
-      fclose((*p)->f);
+      if ((*p)->f) {
+        fclose((*p)->f);
+      }
       (*p)->f = NULL;
+      input_delete(&(*p)->in);
       free(*p);
       *p = NULL;
   }
 }
 
-// Finds the next word from a file
-bool next_word(Parser *p, char *word) {
-  char new_word[MAX_PARSER_LINE_LENGTH + 1] = "";
-  // If the file is not stdin
-  if (p->f != stdin) {
-    // Read a line and save it in current line
-    if (fgets(p->current_line, MAX_PARSER_LINE_LENGTH, p->f) != NULL) {
-              p->current_line[MAX_PARSER_LINE_LENGTH] = '\n';
-      char c = p->current_line[0];
-      for (uint64_t i = 0; c != '\0'; i += 1) {
-        c = p->current_line[i];
-        p->line_offset += 1;
-        if (isalnum(c) != 0 || c == '\'' || c == '-') {
-          if (isalpha(c) != 0) { // if it's alphabetical
-            c = tolower(c);      // change to lower case
-          }
-          new_word[i] = c;
-        } else {
-          // Copy the new word to word
-          my_strcpy(word, new_word);
-          fseek(p->f, p->line_offset, SEEK_SET);
-          return true;
-        }
+// Copies the word at the start of s to word, lower case, and returns how many
+// bytes of s it spans. Sets len to the length of the word, which is at most
+// MAX_PARSER_LINE_LENGTH bytes (the rest is left for the next word). Runs of
+// ASCII word characters are found by the word_span kernel, many bytes at a
+// time; only the characters it stops at go through the Unicode tables, and are
+// case folded, which may change their length. If flags has normalization
+// on, it is done in the same loop: the ASCII runs are copied through the
+// table of the Normalizer, and the other characters are normalized by
+// norm_word_char.
+static uint32_t take_word(const char *s, char *word, uint32_t *len,
+                          uint32_t flags) {
+  uint32_t i = 0;
+  uint32_t n = 0;
+  while (true) {
+    uint32_t w = kernels.word_span(s + i);
+    if (w > MAX_PARSER_LINE_LENGTH - n) {
+      w = MAX_PARSER_LINE_LENGTH - n;
+    }
+    if (flags & NORM_LEET) {
+      for (uint32_t j = 0; j < w; j += 1) {
+        word[n + j] = normalizer.ascii[(uint8_t)s[i + j]];
+      }
+    } else {
+      for (uint32_t j = 0; j < w; j += 1) {
+        char c = s[i + j];
+        word[n + j] = (c >= 'A' && c <= 'Z') ? c + ('a' - 'A') : c;
       }
     }
-    return false;
-
-    // If it's stdin
-  } else {
-    // If this is the beginning of a line
-    if ((!feof(p->f)) & (p->f != NULL)) {
-      if ((c == '\n') & (c != EOF)) {
-        // Get a new line using fgets
-        if (fgets(p->current_line, MAX_PARSER_LINE_LENGTH, p->f) != NULL) {
-          // To handle files with more characters than MAX_PARSER_LINE_LENGTH,
-          // set the last character of the line to \n. This way, it will split
-          // the long line to a couple of smaller lines
-         // p->current_line[MAX_PARSER_LINE_LENGTH] = '\n';
-           c = p->current_line[MAX_PARSER_LINE_LENGTH];
-          if (isalnum(c) == 0 && c != '\'' &&  c != '-') {
-          	p->current_line[MAX_PARSER_LINE_LENGTH] = '\n';
-          }
-          else {
-                for (uint64_t i = MAX_PARSER_LINE_LENGTH; i >=0; i -= 1) {
-          		c = p->current_line[i];
-          		if (isalnum(c) == 0 && c != '\'' &&  c != '-') {
-          		p->current_line[i] = '\n';
-          		}
-          		
-          	}
-          } 
-          // Get a word from this line.
-          // Word stops using either \0, or things other than - ' letters and
-          // numbers
-          p->line_offset = 0; // Reset the line offset each time
-          for (uint64_t i = 0; i < MAX_PARSER_LINE_LENGTH + 1; i += 1) {
-            c = p->current_line[i]; // Gets current character
-            p->line_offset += 1;    // Number of read chars
-            if (isalnum(c) != 0 || c == '\'' || c == '-') {
-              if (isalpha(c) != 0) { // if it's alphabetical
-                c = tolower(c);      // change to lower case
-              }
-              new_word[i] = c;
-            } else {
-              break;
-            }
-          }
-          // change the line offset and return the new word
-          my_strcpy(word, new_word);
-          fseek(p->f, p->line_offset, SEEK_SET);
-          return true;
-        }
+    i += w;
+    n += w;
+    uint32_t k = 0;
+    uint32_t used = 0;
+    uint8_t b = (uint8_t)s[i];
+    if (flags != 0 && (b >= 0x80 || normalizer.ascii[b] != 0)) {
+      used = norm_word_char(s + i, word + n, MAX_PARSER_LINE_LENGTH - n, &k);
+    } else if (b >= 0x80) {
+      used = utf8_word_fold(s + i, word + n, MAX_PARSER_LINE_LENGTH - n, &k);
+    }
+    if (used == 0) {
+      break;
+    }
+    i += used;
+    n += k;
+  }
+  for (uint32_t j = n; j <= NODE_INLINE; j += 1) {
+    word[j] = '\0';
+  }
+  word[n] = '\0';
+  *len = n;
+  return i;
+}
 
-        // If it's not a new line, and there are more characters left
-      } else {
-        // Similar actions as seen above
-        uint64_t target = p->line_offset;
-        for (int i = p->line_offset; c != '\n'; i += 1) {
-          c = p->current_line[i];
-          p->line_offset += 1; // Number of read chars
-          if (isalnum(c) != 0 || c == '\'' || c == '-' || c == '\0') {
-            if (isalpha(c) != 0) { // if it's alphabetical
-              c = tolower(c);      // change to lower case
-            }
-            new_word[i - target] = c;
-          } else {
-            break;
-          }
-        }
-        // Change the line offset and return the new word
-        my_strcpy(word, new_word);
-        fseek(p->f, p->line_offset, SEEK_SET);
-        return true;
-      }
+// Returns the number of bytes of the character at the start of s, which ended
+// a word: 1 for ASCII or a byte that isn't valid UTF-8, else the length of
+// its sequence
+static uint32_t separator_length(const char *s) {
+  if ((uint8_t)s[0] < 0x80) {
+    return 1;
+  }
+  uint32_t cp = 0;
+  uint32_t len = utf8_decode(s, &cp);
+  return len == 0 ? 1 : len;
+}
+
+// Finds the next word from a file and copies it to word, lower case (and
+// normalized with the kinds in flags) and zero padded to NODE_INLINE bytes.
+// Sets len to its length, which the tokenizer knows anyway, so the caller
+// doesn't have to measure the word again. The file is read a line at a time
+// into the Parser, so nothing is allocated, cleared or seeked per word. The
+// text is UTF-8; letters, marks and numbers of every script are word
+// characters.
+static bool read_word(Parser *p, char *word, uint32_t *len, uint32_t flags) {
+  uint64_t t = prof_now();
+  // Read a new line once every word of the current one was returned
+  if (p->current_line[p->line_offset] == '\0') {
+    // The length of the line comes from the read, so it isn't scanned twice
+    uint32_t size = 0;
+    char *line = p->in ? input_gets(p->in, p->current_line,
+                                    MAX_PARSER_LINE_LENGTH, &size)
+                       : fgets(p->current_line, MAX_PARSER_LINE_LENGTH, p->f);
+    if (line == NULL) {
+      return false;
     }
-    return false;
+    p->line_offset = 0;
+    p->bytes += p->in ? size : strlen(p->current_line);
+    t = prof_lap(PROF_READ, t);
   }
+  // Get a word from this line. The word stops at \0 or at anything other
+  // than - ' letters and numbers.
+  char *s = p->current_line + p->line_offset;
+  uint32_t n = take_word(s, word, len, flags);
+  // Skip the character that ended the word, unless it's the end of the line
+  // (or the word was only cut because it is too long)
+  p->line_offset += n;
+  if (s[n] != '\0' && *len < MAX_PARSER_LINE_LENGTH) {
+    p->line_offset += separator_length(s + n);
+  }
+  prof_lap(PROF_TOKENIZE, t);
+  return true;
+}
+
+// Finds the next word from a file, normalized like the text is
+bool next_word(Parser *p, char *word, uint32_t *len) {
+  return read_word(p, word, len, normalizer.flags);
+}
+
+// Finds the next word from a file, only lower cased. A newspeak word is
+// printed as the file has it, so it isn't normalized like the oldspeak it
+// replaces.
+bool next_newspeak(Parser *p, char *word, uint32_t *len) {
+  return read_word(p, word, len, 0);
+}
+
+// Returns the Input the Parser reads from (NULL if it reads a FILE)
+Input *parser_input(Parser *p) { return p->in; }
+
+// Returns the number of bytes read from the file of the Parser so far
+uint64_t parser_bytes(Parser *p) { return p->bytes; }
+
+// Finds the next word of a block of text that is already in memory, starting
+// at *offset, and copies it to word like next_word does for stdin. n is the
+// length of the block, which has to be followed by a '\0' and CPU_SPAN_PAD
+// bytes of slack. Empty words are skipped, and words longer than
+// MAX_PARSER_LINE_LENGTH are split. Sets len to the length of the word.
+// Returns false once the end of the block is reached.
+bool block_word(char *block, uint64_t n, uint64_t *offset, char *word,
+                uint32_t *len) {
+  uint64_t o = *offset;
+  while (o < n) {
+    if (!word_char(block[o])) { // An ASCII separator, so skip it
+      o += 1;
+      continue;
+    }
+    uint32_t w = take_word(block + o, word, len, normalizer.flags);
+    if (w == 0) { // A character that can't start a word
+      o += separator_length(block + o);
+      continue;
+    }
+    if (*len == 0) { // Only characters that normalization removed
+      o += w;
+      continue;
+    }
+    *offset = o + w;
+    return true;
+  }
+  *offset = o;
+  return false;
 }
 
 
@@ -1,18 +1,41 @@
 #ifndef __PARSER_H__
 #define __PARSER_H__
 
+#include "input.h"
+
 #include <stdio.h>
 #include <stdbool.h>
 #include <stdint.h>
 
 #define MAX_PARSER_LINE_LENGTH 1000
 
+// Returns true if the byte c can be part of a word: the ASCII letters, digits,
+// ' and - of the word_span kernel, @ and $ (letters with leet normalization),
+// or any byte of a multibyte UTF-8 character (which may be a letter of another
+// script)
+static inline bool word_char(char c) {
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+         (c >= '0' && c <= '9') || c == '\'' || c == '-' || c == '@' ||
+         c == '$' || (uint8_t)c >= 0x80;
+}
+
 typedef struct Parser Parser;
 
 Parser *parser_create(FILE *f);
 
+Parser *parser_create_input(Input *in);
+
+Input *parser_input(Parser *p);
+
 void parser_delete(Parser **p);
 
-bool next_word(Parser *p, char *word);
+bool next_word(Parser *p, char *word, uint32_t *len);
+
+bool next_newspeak(Parser *p, char *word, uint32_t *len);
+
+uint64_t parser_bytes(Parser *p);
+
+bool block_word(char *block, uint64_t n, uint64_t *offset, char *word,
+                uint32_t *len);
 
 #endif
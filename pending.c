@@ -0,0 +1,80 @@
+#include "pending.h"
+#include "node.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+// Defines what members/fields the Pending queue has.
+// The words are copied back to back (with their NUL) into buf, which holds
+// size bytes. head is where the next word to pop starts and tail where the
+// next one pushed goes. count is the number of words ever pushed.
+typedef struct Pending Pending;
+
+struct Pending {
+  char *buf;
+  uint32_t size;
+  uint32_t head;
+  uint32_t tail;
+  uint64_t count;
+};
+
+// The constructor for the Pending queue. Allocates room for size bytes of
+// words up front, so pushing never allocates. Returns NULL if the memory
+// couldn't be allocated.
+Pending *pending_create(uint32_t size) {
+  Pending *p = (Pending *)malloc(sizeof(Pending));
+  if (p) {
+    p->size = size;
+    p->head = p->tail = 0;
+    p->count = 0;
+    p->buf = (char *)malloc(size);
+    if (p->buf == NULL) {
+      free(p);
+      p = NULL;
+    }
+  }
+  return p;
+}
+
+// The destructor for the Pending queue. Frees its buffer.
+void pending_delete(Pending **p) {
+  if (*p) {
+    free((*p)->buf);
+    free(*p);
+    *p = NULL;
+  }
+}
+
+// Adds a copy of word (of length len) at the end of the queue. Returns false
+// if there is no room left for it.
+bool pending_push(Pending *p, char *word, uint32_t len) {
+  if ((uint64_t)p->tail + len + 1 > p->size) {
+    return false;
+  }
+  memcpy(p->buf + p->tail, word, len + 1);
+  p->tail += len + 1;
+  p->count += 1;
+  return true;
+}
+
+// Copies the word at the front of the queue into word (which must hold
+// MAX_PARSER_LINE_LENGTH + 1 bytes) and sets len to its length. Like
+// next_word, it pads the word with \0 up to NODE_INLINE, which the lookups
+// compare at once. Returns false if the queue is empty. The room of the
+// words is reused once all of them were popped.
+bool pending_pop(Pending *p, char *word, uint32_t *len) {
+  if (p->head == p->tail) {
+    p->head = p->tail = 0;
+    return false;
+  }
+  *len = strlen(p->buf + p->head);
+  memcpy(word, p->buf + p->head, *len + 1);
+  for (uint32_t i = *len; i <= NODE_INLINE; i += 1) {
+    word[i] = '\0';
+  }
+  p->head += *len + 1;
+  return true;
+}
+
+// Returns the number of words ever pushed to the queue
+uint64_t pending_count(Pending *p) { return p->count; }
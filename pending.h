@@ -0,0 +1,22 @@
+#ifndef __PENDING_H__
+#define __PENDING_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Default room of the queue of words waiting for the HashTable (1 MiB)
+#define PENDING_DEFAULT_BYTES (1 << 20)
+
+typedef struct Pending Pending;
+
+Pending *pending_create(uint32_t size);
+
+void pending_delete(Pending **p);
+
+bool pending_push(Pending *p, char *word, uint32_t len);
+
+bool pending_pop(Pending *p, char *word, uint32_t *len);
+
+uint64_t pending_count(Pending *p);
+
+#endif
@@ -0,0 +1,128 @@
+#include "pool.h"
+#include "stats.h"
+
+#include <pthread.h>
+#include <stdlib.h>
+
+// The tasks a worker still has to run: lo to hi - 1. The worker takes tasks
+// from the front, and idle workers steal from the back. Each Deque fills its
+// own cache line so that workers don't slow each other down.
+typedef struct Deque Deque;
+
+struct Deque {
+  _Alignas(CACHE_LINE) pthread_mutex_t lock;
+  uint64_t lo;
+  uint64_t hi;
+};
+
+// The state of a pool_run call, shared by all its workers
+typedef struct Pool Pool;
+
+struct Pool {
+  Deque *deques;
+  uint32_t n_threads;
+  pool_fn fn;
+  void *arg;
+};
+
+// What each worker thread is started with
+typedef struct PoolWorker PoolWorker;
+
+struct PoolWorker {
+  Pool *pool;
+  uint32_t id;
+  pthread_t thread;
+};
+
+// Takes the next task of deque d. Returns false if it's empty.
+static bool take(Deque *d, uint64_t *task) {
+  bool ok = false;
+  pthread_mutex_lock(&d->lock);
+  if (d->lo < d->hi) {
+    *task = d->lo;
+    d->lo += 1;
+    ok = true;
+  }
+  pthread_mutex_unlock(&d->lock);
+  return ok;
+}
+
+// Steals the back half of the tasks of another worker and makes them the
+// tasks of worker id. Returns false if every other worker is out of tasks,
+// which means all of them were taken since no tasks are ever added.
+static bool steal(Pool *p, uint32_t id) {
+  for (uint32_t i = 1; i < p->n_threads; i += 1) {
+    Deque *victim = &p->deques[(id + i) % p->n_threads];
+    uint64_t lo = 0;
+    uint64_t hi = 0;
+    pthread_mutex_lock(&victim->lock);
+    if (victim->lo < victim->hi) {
+      hi = victim->hi;
+      lo = hi - (hi - victim->lo + 1) / 2;
+      victim->hi = lo;
+    }
+    pthread_mutex_unlock(&victim->lock);
+    if (lo < hi) {
+      Deque *d = &p->deques[id];
+      pthread_mutex_lock(&d->lock);
+      d->lo = lo;
+      d->hi = hi;
+      pthread_mutex_unlock(&d->lock);
+      return true;
+    }
+  }
+  return false;
+}
+
+// Runs tasks until there are none left anywhere
+static void *work(void *arg) {
+  PoolWorker *w = (PoolWorker *)arg;
+  Pool *p = w->pool;
+  uint64_t task = 0;
+  do {
+    while (take(&p->deques[w->id], &task)) {
+      p->fn(w->id, task, p->arg);
+    }
+  } while (steal(p, w->id));
+  return NULL;
+}
+
+// Runs fn for each of the tasks 0 to n_tasks - 1 with n_threads threads. Each
+// thread starts with an equal share of the tasks, in order, and once it ran
+// out it steals half of the remaining tasks of another thread. This keeps all
+// threads busy even when some tasks take much longer than others.
+// Returns false if the threads couldn't be started.
+bool pool_run(uint32_t n_threads, uint64_t n_tasks, pool_fn fn, void *arg) {
+  Pool p = {NULL, n_threads, fn, arg};
+  p.deques = (Deque *)aligned_alloc(CACHE_LINE, n_threads * sizeof(Deque));
+  PoolWorker *workers = (PoolWorker *)calloc(n_threads, sizeof(PoolWorker));
+  if (p.deques == NULL || workers == NULL) {
+    free(p.deques);
+    free(workers);
+    return false;
+  }
+  for (uint32_t i = 0; i < n_threads; i += 1) {
+    pthread_mutex_init(&p.deques[i].lock, NULL);
+    p.deques[i].lo = n_tasks * i / n_threads;
+    p.deques[i].hi = n_tasks * (i + 1) / n_threads;
+  }
+  uint32_t started = 0;
+  for (; started < n_threads; started += 1) {
+    workers[started].pool = &p;
+    workers[started].id = started;
+    if (pthread_create(&workers[started].thread, NULL, work,
+                       &workers[started]) != 0) {
+      break;
+    }
+  }
+  // If some threads couldn't be started, the others steal their tasks
+  for (uint32_t i = 0; i < started; i += 1) {
+    pthread_join(workers[i].thread, NULL);
+  }
+  for (uint32_t i = 0; i < n_threads; i += 1) {
+    pthread_mutex_destroy(&p.deques[i].lock);
+  }
+  free(p.deques);
+  free(workers);
+  return started > 0;
+}
@@ -0,0 +1,13 @@
+#ifndef __POOL_H__
+#define __POOL_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// A task of the pool. worker is the number of the thread running it (0 to
+// n_threads - 1) and task the number of the task.
+typedef void (*pool_fn)(uint32_t worker, uint64_t task, void *arg);
+
+bool pool_run(uint32_t n_threads, uint64_t n_tasks, pool_fn fn, void *arg);
+
+#endif
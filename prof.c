@@ -0,0 +1,205 @@
+#include "prof.h"
+
+#include <string.h>
+
+#ifdef PROFILE
+#include <pthread.h>
+#include <semaphore.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <time.h>
+
+// The histograms are log-linear like HdrHistogram: values below
+// PROF_SUB are counted exactly, and above that every power of two is split
+// in PROF_SUB buckets, so a bucket is never off by more than 1/PROF_SUB
+#define PROF_SUB_BITS 5
+#define PROF_SUB      (1 << PROF_SUB_BITS)
+#define PROF_BUCKETS  ((64 - PROF_SUB_BITS + 1) * PROF_SUB)
+
+typedef struct Stage Stage;
+
+// Defines what members/fields a Stage has.
+// Count is the number of times it was recorded, total the sum of the ticks,
+// max the longest, and hist the number of times in each bucket. Only the
+// scan thread writes them, but the dump thread reads them at any time, so
+// they are atomic (and written with plain loads and stores, see add).
+struct Stage {
+  _Atomic uint64_t count;
+  _Atomic uint64_t total;
+  _Atomic uint64_t max;
+  _Atomic uint64_t hist[PROF_BUCKETS];
+};
+
+static char *names[PROF_STAGES] = {"read",  "tokenize", "cache", "bloom",
+                                   "table", "record",   "word"};
+
+static Stage stages[PROF_STAGES];
+static bool json;            // Dump as JSON instead of text
+static uint64_t start_ticks; // Counter and clock when prof_start was called,
+static uint64_t start_ns;    // used to turn ticks into ns
+
+_Thread_local bool prof_active;
+static sem_t requested;   // Posted on SIGUSR1
+static pthread_t dumper; // Dumps the profile when requested is posted
+
+// Returns the monotonic clock in ns
+static uint64_t clock_ns(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// Only wakes the dump thread up, since printing isn't safe in a handler
+static void on_usr1(int sig) {
+  (void)sig;
+  sem_post(&requested);
+}
+
+// The dump thread. Dumps the profile every time SIGUSR1 is received, whether
+// the scan is busy with a word or waiting for its input.
+static void *dump_thread(void *arg) {
+  (void)arg;
+  while (true) {
+    if (sem_wait(&requested) == 0) {
+      prof_dump(stderr);
+    }
+  }
+  return NULL;
+}
+
+// Returns true if format is text or json and this is a PROFILE build
+bool prof_supported(char *format) {
+  return strcmp(format, "text") == 0 || strcmp(format, "json") == 0;
+}
+
+// Starts profiling the calling thread, clearing what was recorded before.
+// Format is text or json. The profile is also dumped on SIGUSR1, by a thread
+// of its own. Returns false if the format is unknown or the thread couldn't
+// be started.
+bool prof_start(char *format) {
+  if (!prof_supported(format)) {
+    return false;
+  }
+  json = strcmp(format, "json") == 0;
+  memset(stages, 0, sizeof(stages));
+  start_ns = clock_ns();
+  start_ticks = prof_now();
+  if (sem_init(&requested, 0, 0) != 0 ||
+      pthread_create(&dumper, NULL, dump_thread, NULL) != 0) {
+    return false;
+  }
+  struct sigaction sa;
+  memset(&sa, 0, sizeof(sa));
+  sa.sa_handler = on_usr1;
+  sa.sa_flags = SA_RESTART;
+  sigemptyset(&sa.sa_mask);
+  sigaction(SIGUSR1, &sa, NULL);
+  prof_active = true;
+  return true;
+}
+
+// Returns the bucket of the histogram that counts value v
+static uint32_t bucket(uint64_t v) {
+  if (v < PROF_SUB) {
+    return v;
+  }
+  uint32_t shift = 63 - __builtin_clzll(v) - PROF_SUB_BITS;
+  return (shift + 1) * PROF_SUB + ((v >> shift) & (PROF_SUB - 1));
+}
+
+// Returns the largest value counted by bucket b
+static uint64_t bucket_max(uint32_t b) {
+  if (b < PROF_SUB) {
+    return b;
+  }
+  uint32_t shift = b / PROF_SUB - 1;
+  uint64_t low = (uint64_t)(PROF_SUB + b % PROF_SUB) << shift;
+  return low + ((uint64_t)1 << shift) - 1;
+}
+
+// Adds v to a counter of a Stage. Only one thread writes the counters, so a
+// relaxed load and store do, which cost no more than a plain add.
+static inline void add(_Atomic uint64_t *counter, uint64_t v) {
+  uint64_t c = atomic_load_explicit(counter, memory_order_relaxed);
+  atomic_store_explicit(counter, c + v, memory_order_relaxed);
+}
+
+// Adds ticks to the total and the histogram of a stage
+void prof_record(uint32_t stage, uint64_t ticks) {
+  Stage *s = &stages[stage];
+  add(&s->count, 1);
+  add(&s->total, ticks);
+  if (ticks > atomic_load_explicit(&s->max, memory_order_relaxed)) {
+    atomic_store_explicit(&s->max, ticks, memory_order_relaxed);
+  }
+  add(&s->hist[bucket(ticks)], 1);
+}
+
+// Returns the value below which a fraction q of the records of s are
+static uint64_t percentile(Stage *s, double q) {
+  uint64_t rank = (uint64_t)(q * s->count);
+  uint64_t seen = 0;
+  for (uint32_t b = 0; b < PROF_BUCKETS; b += 1) {
+    seen += s->hist[b];
+    if (seen > rank) {
+      return bucket_max(b) < s->max ? bucket_max(b) : s->max;
+    }
+  }
+  return s->max;
+}
+
+// Prints the time of every stage and the p50, p99 and p999 of its records in
+// ns, as text or JSON. Ticks are turned into ns with the rate measured since
+// prof_start. While the scan runs, the stages may move on during the dump,
+// so its numbers can be a few records apart. The whole dump is printed at
+// once, even if another thread dumps at the same time.
+void prof_dump(FILE *f) {
+  flockfile(f);
+  uint64_t ticks = prof_now() - start_ticks;
+  uint64_t ns = clock_ns() - start_ns;
+  double scale = ticks == 0 ? 1 : (double)ns / ticks;
+  if (json) {
+    fprintf(f, "{\"elapsed_ns\": %lu, \"stages\": [", ns);
+  } else {
+    fprintf(f, "profile after %.3lf ms:\n", ns / 1e6);
+    fprintf(f, "%-9s %12s %12s %10s %10s %10s %10s\n", "stage", "count",
+            "total ms", "p50 ns", "p99 ns", "p999 ns", "max ns");
+  }
+  for (uint32_t i = 0; i < PROF_STAGES; i += 1) {
+    Stage *s = &stages[i];
+    double total = s->total * scale;
+    double p50 = percentile(s, 0.5) * scale;
+    double p99 = percentile(s, 0.99) * scale;
+    double p999 = percentile(s, 0.999) * scale;
+    double max = s->max * scale;
+    if (json) {
+      fprintf(f,
+              "%s{\"stage\": \"%s\", \"count\": %lu, \"total_ns\": %.0lf, "
+              "\"p50_ns\": %.0lf, \"p99_ns\": %.0lf, \"p999_ns\": %.0lf, "
+              "\"max_ns\": %.0lf}",
+              i == 0 ? "" : ", ", names[i], s->count, total, p50, p99, p999,
+              max);
+    } else {
+      fprintf(f, "%-9s %12lu %12.3lf %10.0lf %10.0lf %10.0lf %10.0lf\n",
+              names[i], s->count, total / 1e6, p50, p99, p999, max);
+    }
+  }
+  if (json) {
+    fprintf(f, "]}\n");
+  }
+  fflush(f);
+  funlockfile(f);
+}
+#else
+// Profiling is compiled out, so no format is supported
+bool prof_supported(char *format) {
+  (void)format;
+  return false;
+}
+
+// Profiling is compiled out, so it can't be started
+bool prof_start(char *format) {
+  (void)format;
+  return false;
+}
+#endif
@@ -0,0 +1,71 @@
+#ifndef __PROF_H__
+#define __PROF_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+// The stages of the scan loop that are timed. The word stage is the whole
+// time spent on one word, from reading it to recording it.
+#define PROF_READ     0
+#define PROF_TOKENIZE 1
+#define PROF_CACHE    2
+#define PROF_BLOOM    3
+#define PROF_TABLE    4
+#define PROF_RECORD   5
+#define PROF_WORD     6
+#define PROF_STAGES   7
+
+// Built with -DPROFILE (make CPPFLAGS=-DPROFILE), the sequential scan loop
+// records the time it spends in each stage with the cycle counter, and keeps
+// a latency histogram of every stage. Otherwise no format is supported,
+// prof_start fails and every other call compiles to nothing.
+bool prof_supported(char *format);
+
+bool prof_start(char *format);
+
+#ifdef PROFILE
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#else
+#include <time.h>
+#endif
+
+extern _Thread_local bool prof_active;
+
+void prof_record(uint32_t stage, uint64_t ticks);
+
+void prof_dump(FILE *f);
+
+// Reads the cycle counter (or the monotonic clock in ns on other CPUs)
+static inline uint64_t prof_now(void) {
+#if defined(__x86_64__)
+  return __rdtsc();
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+// Records the time since the start of a stage and returns now, the start of
+// the next one. Only the thread that called prof_start records anything.
+static inline uint64_t prof_lap(uint32_t stage, uint64_t since) {
+  if (!prof_active) {
+    return 0;
+  }
+  uint64_t now = prof_now();
+  prof_record(stage, now - since);
+  return now;
+}
+#else
+static inline uint64_t prof_now(void) { return 0; }
+static inline uint64_t prof_lap(uint32_t stage, uint64_t since) {
+  (void)stage;
+  (void)since;
+  return 0;
+}
+static inline void prof_dump(FILE *f) { (void)f; }
+#endif
+
+#endif
@@ -0,0 +1,240 @@
+#include "rc.h"
+#include "cpu.h"
+#include "seed.h"
+
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define RC_WAYS 4
+#define RC_LOCKS 64
+
+// The sets take a quarter of the memory of the cache, and the offense words
+// of the documents the rest
+#define RC_SETS_SHARE 4
+
+// One set of the cache: RC_WAYS documents, each with the 128-bit hash of its
+// bytes, its Result, and its offense words (size bytes, packed by pack). A
+// hash of 0 marks an empty way. Within a set, ways are replaced with the
+// CLOCK algorithm: ref has a bit per way that is set when it is used, and
+// hand is the next way to look at.
+typedef struct ResultSet ResultSet;
+
+struct ResultSet {
+  uint64_t key[RC_WAYS][2];
+  Result result[RC_WAYS];
+  char *words[RC_WAYS];
+  uint64_t size[RC_WAYS];
+  uint8_t ref;
+  uint8_t hand;
+};
+
+// Defines what members/fields the ResultCache has.
+// sets holds n_sets sets. seed is the random seed of the hashes. Set i is
+// guarded by lock i % RC_LOCKS, so threads rarely wait for each other.
+// used is the number of bytes the offense words of all the sets take, which
+// is kept under room.
+typedef struct ResultCache ResultCache;
+
+struct ResultCache {
+  ResultSet *sets;
+  uint64_t n_sets;
+  uint128 seed;
+  pthread_mutex_t locks[RC_LOCKS];
+  _Atomic uint64_t used;
+  uint64_t room;
+};
+
+// What each offense starts with in the packed words of a document. It is
+// followed by the oldspeak and, if new_len isn't NO_NEWSPEAK, the newspeak,
+// each with a zero byte after it.
+typedef struct Packed Packed;
+
+struct Packed {
+  uint32_t len;
+  uint32_t fp;
+  uint32_t new_len;
+};
+
+#define NO_NEWSPEAK UINT32_MAX
+
+// The constructor for the ResultCache. Creates a cache that uses at most
+// bytes bytes for its sets and the offense words of its documents. Returns
+// NULL if that's not enough for one set or the memory couldn't be allocated.
+ResultCache *rc_create(uint64_t bytes) {
+  uint64_t n_sets = bytes / RC_SETS_SHARE / sizeof(ResultSet);
+  if (n_sets == 0) {
+    return NULL;
+  }
+  ResultCache *rc = (ResultCache *)malloc(sizeof(ResultCache));
+  if (rc) {
+    rc->n_sets = n_sets;
+    rc->sets = (ResultSet *)calloc(n_sets, sizeof(ResultSet));
+    if (rc->sets == NULL) {
+      free(rc);
+      return NULL;
+    }
+    rc->seed.first = seed_next();
+    rc->seed.second = seed_next();
+    for (uint32_t i = 0; i < RC_LOCKS; i += 1) {
+      pthread_mutex_init(&rc->locks[i], NULL);
+    }
+    atomic_init(&rc->used, 0);
+    rc->room = bytes - n_sets * sizeof(ResultSet);
+  }
+  return rc;
+}
+
+// The destructor for a ResultCache. Also frees the offense words it holds.
+void rc_delete(ResultCache **rc) {
+  if (*rc) {
+    for (uint32_t i = 0; i < RC_LOCKS; i += 1) {
+      pthread_mutex_destroy(&(*rc)->locks[i]);
+    }
+    for (uint64_t i = 0; i < (*rc)->n_sets; i += 1) {
+      for (uint32_t w = 0; w < RC_WAYS; w += 1) {
+        free((*rc)->sets[i].words[w]);
+      }
+    }
+    free((*rc)->sets);
+    free(*rc);
+    *rc = NULL;
+  }
+}
+
+// Defines what pack works with: the packed words, and the offset before
+// which the next offense goes, since the lists are walked from the newest
+// offense to the oldest.
+typedef struct Packing Packing;
+
+struct Packing {
+  char *words;
+  uint64_t at;
+};
+
+// Returns the number of bytes an offense takes in the packed words
+static uint64_t packed_size(Node *n) {
+  uint64_t size = sizeof(Packed) + n->len + 1;
+  return n->newspeak ? size + strlen(n->newspeak) + 1 : size;
+}
+
+// Adds the size of an offense to the total at arg
+static void measure(Node *n, void *arg) { *(uint64_t *)arg += packed_size(n); }
+
+// Adds an offense in front of those already packed
+static void pack(Node *n, void *arg) {
+  Packing *p = (Packing *)arg;
+  p->at -= packed_size(n);
+  char *to = p->words + p->at;
+  Packed h = {n->len, n->fp,
+              n->newspeak ? (uint32_t)strlen(n->newspeak) : NO_NEWSPEAK};
+  memcpy(to, &h, sizeof(Packed));
+  to += sizeof(Packed);
+  memcpy(to, n->oldspeak, n->len + 1);
+  if (n->newspeak) {
+    memcpy(to + n->len + 1, n->newspeak, h.new_len + 1);
+  }
+}
+
+// Inserts the packed words (size bytes) into the two lists, oldest first, so
+// they come out in the order the scan left them in
+static void unpack(char *words, uint64_t size, LinkedList *thought_crime,
+                   LinkedList *rightspeak) {
+  uint64_t at = 0;
+  while (at < size) {
+    Packed h;
+    memcpy(&h, words + at, sizeof(Packed));
+    char *oldspeak = words + at + sizeof(Packed);
+    char *newspeak = h.new_len == NO_NEWSPEAK ? NULL : oldspeak + h.len + 1;
+    ll_insert(newspeak ? rightspeak : thought_crime, oldspeak, newspeak, h.len,
+              h.fp);
+    at += sizeof(Packed) + h.len + 1 + (newspeak ? h.new_len + 1 : 0);
+  }
+}
+
+// Returns the number of documents the cache can hold
+uint64_t rc_entries(ResultCache *rc) { return rc->n_sets * RC_WAYS; }
+
+// Returns the key of a document: the 128-bit hash of its n bytes
+uint128 rc_key(ResultCache *rc, const char *data, uint64_t n) {
+  return kernels.hash128(data, n, rc->seed);
+}
+
+// Looks for the document with the given key. If it's there, sets r to its
+// Result, inserts its offenses into the (empty) lists thought_crime and
+// rightspeak, and returns true. Else, return false.
+bool rc_lookup(ResultCache *rc, uint128 key, Result *r,
+               LinkedList *thought_crime, LinkedList *rightspeak) {
+  uint64_t i = key.first % rc->n_sets;
+  ResultSet *s = &rc->sets[i];
+  bool found = false;
+  pthread_mutex_lock(&rc->locks[i % RC_LOCKS]);
+  for (uint32_t w = 0; w < RC_WAYS; w += 1) {
+    if (s->key[w][0] == key.first && s->key[w][1] == key.second) {
+      *r = s->result[w];
+      unpack(s->words[w], s->size[w], thought_crime, rightspeak);
+      s->ref |= 1 << w;
+      found = true;
+      break;
+    }
+  }
+  pthread_mutex_unlock(&rc->locks[i % RC_LOCKS]);
+  return found;
+}
+
+// Remembers the Result of the document with the given key, and its offenses,
+// the words in the lists thought_crime and rightspeak. The clock hand of its
+// set skips (and clears) the ways that were used since it last passed them,
+// and the first one that wasn't is replaced. A document whose words don't fit
+// in what is left of the memory of the cache isn't remembered.
+void rc_insert(ResultCache *rc, uint128 key, Result *r,
+               LinkedList *thought_crime, LinkedList *rightspeak) {
+  if (key.first == 0 && key.second == 0) { // Would look like an empty way
+    return;
+  }
+  // The words are packed before the set is locked: the rightspeak offenses
+  // go last, and the newest offense of each list after the older ones
+  uint64_t size = 0;
+  ll_for_each(thought_crime, measure, &size);
+  ll_for_each(rightspeak, measure, &size);
+  if (atomic_fetch_add(&rc->used, size) + size > rc->room) {
+    atomic_fetch_sub(&rc->used, size);
+    return;
+  }
+  Packing p = {size ? (char *)malloc(size) : NULL, size};
+  if (size && p.words == NULL) {
+    atomic_fetch_sub(&rc->used, size);
+    return;
+  }
+  ll_for_each(rightspeak, pack, &p);
+  ll_for_each(thought_crime, pack, &p);
+
+  uint64_t i = key.first % rc->n_sets;
+  ResultSet *s = &rc->sets[i];
+  pthread_mutex_lock(&rc->locks[i % RC_LOCKS]);
+  // Another thread may have added the same document in the meantime
+  for (uint32_t w = 0; w < RC_WAYS; w += 1) {
+    if (s->key[w][0] == key.first && s->key[w][1] == key.second) {
+      pthread_mutex_unlock(&rc->locks[i % RC_LOCKS]);
+      atomic_fetch_sub(&rc->used, size);
+      free(p.words);
+      return;
+    }
+  }
+  while (s->ref & (1 << s->hand)) {
+    s->ref &= ~(1 << s->hand);
+    s->hand = (s->hand + 1) % RC_WAYS;
+  }
+  uint32_t w = s->hand;
+  char *old = s->words[w];
+  atomic_fetch_sub(&rc->used, s->size[w]);
+  s->key[w][0] = key.first;
+  s->key[w][1] = key.second;
+  s->result[w] = *r;
+  s->words[w] = p.words;
+  s->size[w] = size;
+  s->hand = (s->hand + 1) % RC_WAYS;
+  pthread_mutex_unlock(&rc->locks[i % RC_LOCKS]);
+  free(old);
+}
@@ -0,0 +1,37 @@
+#ifndef __RC_H__
+#define __RC_H__
+
+#include "city.h"
+#include "ll.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#define RC_DEFAULT_MB 16
+
+// The verdict of a document: the number of different badspeak and oldspeak
+// words it has. The cache keeps the words themselves next to it.
+typedef struct Result Result;
+
+struct Result {
+  uint32_t thought_crime;
+  uint32_t rightspeak;
+};
+
+typedef struct ResultCache ResultCache;
+
+ResultCache *rc_create(uint64_t bytes);
+
+void rc_delete(ResultCache **rc);
+
+uint64_t rc_entries(ResultCache *rc);
+
+uint128 rc_key(ResultCache *rc, const char *data, uint64_t n);
+
+bool rc_lookup(ResultCache *rc, uint128 key, Result *r,
+               LinkedList *thought_crime, LinkedList *rightspeak);
+
+void rc_insert(ResultCache *rc, uint128 key, Result *r,
+               LinkedList *thought_crime, LinkedList *rightspeak);
+
+#endif
@@ -0,0 +1,237 @@
+#include "reload.h"
+#include "dict.h"
+#include <pthread.h>
+#include <signal.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+// A reader slot holding UINT64_MAX is not using any generation.
+#define READER_IDLE UINT64_MAX
+
+// Each reader gets its own cache line so that entering and leaving a scan
+// doesn't bounce a line shared with other readers.
+typedef struct ReaderSlot ReaderSlot;
+
+struct ReaderSlot {
+  _Alignas(64) _Atomic uint64_t epoch;
+};
+
+// Defines what members/fields the Reloader has.
+// current is the Dictionary generation new scans should use. epoch is bumped
+// every time a new generation is published. readers holds the epoch each
+// reader entered at, so that the old generation is only freed once every
+// reader has left it. The background thread rebuilds the Dictionary on SIGHUP,
+// when the modification time of one of its files changes, or when its shared
+// dictionary published a new generation. With a counting BloomFilter, the
+// changes to the files are applied to the current Dictionary in place
+// instead: words is a copy of the words it holds, which the files are
+// compared with off to the side, and updating is only set (which keeps
+// readers from entering) while the changes found are applied.
+typedef struct Reloader Reloader;
+
+struct Reloader {
+  _Atomic(Dictionary *) current;
+  _Atomic uint64_t epoch;
+  _Atomic bool stop;
+  _Atomic bool updating;
+  HashTable *words;
+  uint32_t n_readers;
+  ReaderSlot *readers;
+  pthread_t thread;
+  struct timespec bad_mtime;
+  struct timespec new_mtime;
+  _Atomic uint32_t generations;
+};
+
+// Returns the modification time of a file (zero if it can't be stat'ed)
+static struct timespec file_mtime(char *name) {
+  struct stat st;
+  struct timespec t = {0, 0};
+  if (stat(name, &st) == 0) {
+    t = st.st_mtim;
+  }
+  return t;
+}
+
+// Returns true if the two times are different
+static bool mtime_changed(struct timespec a, struct timespec b) {
+  return a.tv_sec != b.tv_sec || a.tv_nsec != b.tv_nsec;
+}
+
+// Publishes a new generation and frees the old one once no reader that could
+// have seen it is still inside reloader_enter/reloader_exit.
+static void publish(Reloader *r, Dictionary *next) {
+  Dictionary *old = atomic_exchange(&r->current, next);
+  uint64_t e = atomic_fetch_add(&r->epoch, 1) + 1;
+  for (uint32_t i = 0; i < r->n_readers; i += 1) {
+    // Readers that entered before the new epoch may still hold old
+    uint64_t re;
+    while ((re = atomic_load(&r->readers[i].epoch)) != READER_IDLE && re < e) {
+      usleep(1000);
+    }
+  }
+  dict_delete(&old);
+  atomic_fetch_add(&r->generations, 1);
+}
+
+// Applies the changes of delta to the current Dictionary d in place, once
+// every reader has left it (and while no new one can enter). The readers wait
+// for as long as the changes take, not for the whole dictionary. Returns false
+// if d has to be rebuilt after all.
+static bool update(Reloader *r, Dictionary *d, Delta *delta) {
+  if (delta_size(delta) == 0) {
+    return true;
+  }
+  atomic_store(&r->updating, true);
+  for (uint32_t i = 0; i < r->n_readers; i += 1) {
+    while (atomic_load(&r->readers[i].epoch) != READER_IDLE) {
+      usleep(1000);
+    }
+  }
+  bool ok = dict_apply(d, delta);
+  atomic_store(&r->updating, false);
+  atomic_fetch_add(&r->generations, 1);
+  return ok;
+}
+
+// The background thread. Waits (up to a second at a time) for SIGHUP and
+// checks whether the dictionary files changed (or a new shared generation was
+// published), rebuilding when either happens.
+static void *reload_thread(void *arg) {
+  Reloader *r = (Reloader *)arg;
+  sigset_t set;
+  sigemptyset(&set);
+  sigaddset(&set, SIGHUP);
+  struct timespec second = {1, 0};
+  while (!atomic_load(&r->stop)) {
+    bool hup = sigtimedwait(&set, NULL, &second) == SIGHUP;
+    if (atomic_load(&r->stop)) {
+      break;
+    }
+    Dictionary *d = atomic_load(&r->current);
+    struct timespec bad = file_mtime(BADSPEAK_FILE);
+    struct timespec new = file_mtime(NEWSPEAK_FILE);
+    if (hup || mtime_changed(bad, r->bad_mtime) ||
+        mtime_changed(new, r->new_mtime) || dict_outdated(d)) {
+      r->bad_mtime = bad;
+      r->new_mtime = new;
+      // Only this thread ever replaces current, so d is still safe to read.
+      // The files are compared with the copy of its words, not with d, so
+      // the scan goes on meanwhile.
+      HashTable *fresh = dict_read(d);
+      Delta *delta = dict_diff(r->words, fresh);
+      bool ok = false;
+      if (delta && !dict_worn(d, delta)) {
+        // Even if a BloomFilter counter was off, d now holds the words of
+        // fresh
+        ok = update(r, d, delta);
+        delta_delete(&delta);
+        ht_delete(&r->words);
+        r->words = fresh;
+        fresh = NULL;
+      }
+      delta_delete(&delta);
+      ht_delete(&fresh);
+      if (!ok) {
+        Dictionary *next = dict_rebuild(d);
+        if (next) {
+          ht_delete(&r->words);
+          r->words = dict_words(next);
+          publish(r, next);
+        }
+      }
+    }
+  }
+  return NULL;
+}
+
+// The constructor for the Reloader. Takes ownership of the loaded Dictionary d,
+// copies its words if it can be updated in place, and starts the background
+// thread. n_readers is the number of threads that
+// will call reloader_enter. SIGHUP is blocked in the calling thread (and the
+// threads it creates afterwards) so that only the reload thread receives it.
+Reloader *reloader_create(Dictionary *d, uint32_t n_readers) {
+  Reloader *r = (Reloader *)malloc(sizeof(Reloader));
+  if (r) {
+    atomic_init(&r->current, d);
+    atomic_init(&r->epoch, 0);
+    atomic_init(&r->stop, false);
+    atomic_init(&r->updating, false);
+    atomic_init(&r->generations, 1);
+    r->words = dict_words(d);
+    r->n_readers = n_readers;
+    r->readers =
+        (ReaderSlot *)aligned_alloc(64, sizeof(ReaderSlot) * n_readers);
+    if (r->readers == NULL) {
+      ht_delete(&r->words);
+      free(r);
+      return NULL;
+    }
+    for (uint32_t i = 0; i < n_readers; i += 1) {
+      atomic_init(&r->readers[i].epoch, READER_IDLE);
+    }
+    r->bad_mtime = file_mtime(BADSPEAK_FILE);
+    r->new_mtime = file_mtime(NEWSPEAK_FILE);
+    sigset_t set;
+    sigemptyset(&set);
+    sigaddset(&set, SIGHUP);
+    pthread_sigmask(SIG_BLOCK, &set, NULL);
+    if (pthread_create(&r->thread, NULL, reload_thread, r) != 0) {
+      ht_delete(&r->words);
+      free(r->readers);
+      free(r);
+      r = NULL;
+    }
+  }
+  return r;
+}
+
+// The destructor for the Reloader. Stops the background thread and frees the
+// current Dictionary generation and the copy of its words. No reader may be inside a scan.
+void reloader_delete(Reloader **r) {
+  if (*r) {
+    atomic_store(&(*r)->stop, true);
+    pthread_kill((*r)->thread, SIGHUP); // Wakes the thread up
+    pthread_join((*r)->thread, NULL);
+    Dictionary *d = atomic_load(&(*r)->current);
+    dict_delete(&d);
+    ht_delete(&(*r)->words);
+    free((*r)->readers);
+    free(*r);
+    *r = NULL;
+  }
+}
+
+// Pins and returns the current Dictionary generation for the given reader. The
+// generation stays valid until the reader calls reloader_exit. Only blocks
+// while the Dictionary is being updated in place: the reader announces itself
+// before it checks updating, and the reload thread sets updating before it
+// checks the readers, so one of them always sees the other.
+Dictionary *reloader_enter(Reloader *r, uint32_t reader) {
+  while (true) {
+    atomic_store(&r->readers[reader].epoch, atomic_load(&r->epoch));
+    if (!atomic_load(&r->updating)) {
+      return atomic_load(&r->current);
+    }
+    atomic_store(&r->readers[reader].epoch, READER_IDLE);
+    while (atomic_load(&r->updating)) {
+      usleep(1000);
+    }
+  }
+}
+
+// Releases the generation pinned by reloader_enter
+void reloader_exit(Reloader *r, uint32_t reader) {
+  atomic_store_explicit(&r->readers[reader].epoch, READER_IDLE,
+                        memory_order_release);
+}
+
+// Returns the number of Dictionary generations that have been in use
+uint32_t reloader_generations(Reloader *r) {
+  return atomic_load(&r->generations);
+}
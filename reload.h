@@ -0,0 +1,20 @@
+#ifndef __RELOAD_H__
+#define __RELOAD_H__
+
+#include "dict.h"
+
+#include <stdint.h>
+
+typedef struct Reloader Reloader;
+
+Reloader *reloader_create(Dictionary *d, uint32_t n_readers);
+
+void reloader_delete(Reloader **r);
+
+Dictionary *reloader_enter(Reloader *r, uint32_t reader);
+
+void reloader_exit(Reloader *r, uint32_t reader);
+
+uint32_t reloader_generations(Reloader *r);
+
+#endif
@@ -0,0 +1,441 @@
+#include "scan.h"
+#include "alloc.h"
+#include "cpu.h"
+#include "parser.h"
+#include "tc.h"
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SCAN_BLOCK (1 << 20)
+#define JOBS_PER_THREAD 2
+#define OFFENSES_CHUNK 65536
+
+// The scratch space of a thread that scans: its stats, its token cache (NULL
+// if there is none) and the buffer words are copied into. hit and newspeak
+// hold the last word found in a Trie. Everything the scan loop needs is
+// allocated up front, so it never allocates memory itself.
+typedef struct ScanContext ScanContext;
+
+struct ScanContext {
+  Counters counters;
+  TokenCache *tc;
+  char word[MAX_PARSER_LINE_LENGTH + 1];
+  Node hit;
+  char newspeak[MAX_PARSER_LINE_LENGTH + 1];
+};
+
+// A block of the input and the offenses found in it.
+// buf holds n bytes of text followed by a '\0' and CPU_SPAN_PAD bytes of
+// slack. done is set once a worker scanned it.
+typedef struct Job Job;
+
+struct Job {
+  char *buf;
+  uint64_t n;
+  Offenses *offenses;
+  bool done;
+};
+
+// The state shared by the reading thread and the workers.
+// jobs is a ring of n_jobs blocks. n_read blocks were read so far, and
+// n_taken of them were taken by a worker. eof is set once the input ended.
+// The dictionary is either d, or the current generation of reloader. Each
+// worker has its own ScanContext, so the dictionary is never written to.
+typedef struct Scan Scan;
+
+struct Scan {
+  pthread_mutex_t lock;
+  pthread_cond_t work; // Signaled when a block is read or the input ends
+  pthread_cond_t done; // Signaled when a block was scanned
+  Job *jobs;
+  uint32_t n_jobs;
+  uint64_t n_read;
+  uint64_t n_taken;
+  bool eof;
+  Dictionary *dict;
+  Reloader *reloader;
+};
+
+// What each worker thread is started with
+typedef struct Worker Worker;
+
+struct Worker {
+  Scan *scan;
+  uint32_t id;
+  pthread_t thread;
+  ScanContext *ctx;
+};
+
+// Returns the fingerprint of a word in the offense lists. Unlike that of its
+// node, it doesn't depend on the salt of the dictionary, which every -r
+// generation (and every rehash) changes, so the same word is listed once
+// whichever generation it was found in.
+uint32_t offense_fp(char *word, uint32_t len) {
+  return (uint32_t)(kernels.hash64(word, len, 0) >> 32);
+}
+
+// The constructor for Offenses. Creates two empty move-to-front lists, like
+// the ones of the sequential scan, and an arena for their nodes. The arena
+// gets room for every word of the dictionary d up front, so recording
+// offenses never allocates memory (d can be NULL if that isn't needed).
+// Returns NULL if the memory couldn't be allocated.
+Offenses *offenses_create(Dictionary *d) {
+  Offenses *o = (Offenses *)malloc(sizeof(Offenses));
+  if (o) {
+    o->arena = arena_create(OFFENSES_CHUNK);
+    o->thought_crime = ll_create(true, o->arena);
+    o->rightspeak = ll_create(true, o->arena);
+    if (!o->arena || !o->thought_crime || !o->rightspeak ||
+        (d && !offenses_reserve(o, d))) {
+      offenses_delete(&o);
+    }
+  }
+  return o;
+}
+
+// Makes room in the arena of the offenses for every word of the dictionary
+// d on top of the offenses already recorded, so recording the offenses of d
+// never allocates memory. Called again when the scan moves on to another
+// generation of the dictionary (which may be bigger), before the allocation
+// guard is turned on. Returns false if the memory couldn't be allocated.
+bool offenses_reserve(Offenses *o, Dictionary *d) {
+  uint64_t reserve = dict_bytes(d);
+  if (reserve > UINT32_MAX) {
+    reserve = UINT32_MAX;
+  }
+  return arena_reserve(o->arena, reserve);
+}
+
+// Makes room in the arena of the offenses for one more offense, of any length.
+// The offenses of a hash file may outgrow what offenses_reserve made room for
+// (it is capped to DICT_DISK_RESERVE), so its scans call this before they
+// record an offense, with the allocation guard off, and the recording itself
+// never allocates. Returns false if the memory couldn't be allocated.
+bool offenses_headroom(Offenses *o) {
+  return arena_reserve(o->arena, dict_word_bytes(MAX_PARSER_LINE_LENGTH,
+                                                 MAX_PARSER_LINE_LENGTH));
+}
+
+// The destructor for Offenses. Deletes both lists and their nodes.
+void offenses_delete(Offenses **o) {
+  if (*o) {
+    ll_delete(&(*o)->thought_crime);
+    ll_delete(&(*o)->rightspeak);
+    arena_delete(&(*o)->arena);
+    free(*o);
+    *o = NULL;
+  }
+}
+
+// Empties both lists. The memory of their nodes is kept for the next ones.
+void offenses_clear(Offenses *o) {
+  ll_clear(o->thought_crime);
+  ll_clear(o->rightspeak);
+  arena_reset(o->arena);
+}
+
+// The constructor for a ScanContext, with a token cache of cache_entries
+// entries (none if 0). Returns NULL if the memory couldn't be allocated.
+ScanContext *scan_context_create(uint32_t cache_entries) {
+  ScanContext *ctx =
+      (ScanContext *)aligned_alloc(CACHE_LINE, sizeof(ScanContext));
+  if (ctx) {
+    counters_clear(&ctx->counters);
+    ctx->tc = tc_create(cache_entries);
+  }
+  return ctx;
+}
+
+// The destructor for a ScanContext.
+void scan_context_delete(ScanContext **ctx) {
+  if (*ctx) {
+    tc_delete(&(*ctx)->tc);
+    free(*ctx);
+    *ctx = NULL;
+  }
+}
+
+// Returns the buffer words are copied into, which holds
+// MAX_PARSER_LINE_LENGTH + 1 bytes
+char *scan_word(ScanContext *ctx) { return ctx->word; }
+
+// Returns the token cache of the ScanContext (NULL if it has none)
+TokenCache *scan_cache(ScanContext *ctx) { return ctx->tc; }
+
+// Returns the stats of the ScanContext, including those of its token cache
+Counters *scan_counters(ScanContext *ctx) {
+  if (ctx->tc) {
+    tc_stats(ctx->tc, &ctx->counters.cache_hits, &ctx->counters.cache_misses);
+  }
+  return &ctx->counters;
+}
+
+// Looks up word (of length len) in the Trie t. Returns a Node of the
+// ScanContext that holds its newspeak, length and fingerprint like a Node of
+// the HashTable would, or NULL if word isn't in t. The Node is only valid
+// until the next lookup, so it must not be cached.
+Node *scan_trie(ScanContext *ctx, Trie *t, char *word, uint32_t len) {
+  int64_t value = trie_lookup(t, word, len);
+  if (value < 0) {
+    ctx->counters.trie_misses += 1;
+    return NULL;
+  }
+  ctx->counters.trie_hits += 1;
+  ctx->hit.newspeak = trie_newspeak(t, value, ctx->newspeak);
+  ctx->hit.len = len;
+  ctx->hit.fp = 0;
+  return &ctx->hit;
+}
+
+// Looks up word (of length len) in the hash file dh, like scan_trie
+Node *scan_disk(ScanContext *ctx, DiskHash *dh, char *word, uint32_t len) {
+  int found = dh_lookup(dh, word, len, ctx->newspeak, &ctx->counters);
+  if (found == DH_MISS) {
+    return NULL;
+  }
+  ctx->hit.newspeak = found == DH_NEWSPEAK ? ctx->newspeak : NULL;
+  ctx->hit.len = len;
+  ctx->hit.fp = 0;
+  return &ctx->hit;
+}
+
+// Looks up every word of text (n bytes followed by a '\0' and CPU_SPAN_PAD
+// bytes of slack) in the dictionary d and records the offenses in o. Words
+// found in the token cache of ctx are not looked up again. The dictionary is
+// only read, and the stats are added to ctx, so many threads can scan at once.
+// Nothing is allocated while scanning as long as o was created for d (with a
+// hash file, the arena of o is grown between words when it runs low).
+void scan_text(char *text, uint64_t n, Dictionary *d, ScanContext *ctx,
+               Offenses *o) {
+  BloomFilter *bf = dict_bf(d);
+  HashTable *ht = dict_ht(d);
+  Trie *trie = dict_trie(d);
+  DiskHash *disk = dict_disk(d);
+  TokenCache *tc = ctx->tc;
+  Counters *c = &ctx->counters;
+  char *word = ctx->word;
+  if (tc) {
+    tc_use(tc, dict_id(d));
+  }
+  alloc_guard(true);
+  uint64_t offset = 0;
+  uint32_t len = 0;
+  while (block_word(text, n, &offset, word, &len)) {
+    c->tokens += 1;
+    Node *node = NULL;
+    if (trie) {
+      node = scan_trie(ctx, trie, word, len);
+    } else if (disk) {
+      node = scan_disk(ctx, disk, word, len);
+    } else if (tc == NULL || !tc_lookup(tc, word, len, &node)) {
+      if (bf_probe_r(bf, word, len, c)) {
+        node = ht_lookup_r(ht, word, len, c);
+      }
+      if (tc) {
+        tc_insert(tc, word, len, node);
+      }
+    }
+    if (node && disk) {
+      alloc_guard(false);
+      offenses_headroom(o);
+      alloc_guard(true);
+    }
+    if (node) {
+      LinkedList *ll =
+          node->newspeak == NULL ? o->thought_crime : o->rightspeak;
+      ll_insert(ll, word, node->newspeak, node->len,
+                offense_fp(word, node->len));
+    }
+  }
+  c->bytes += n;
+  alloc_guard(false);
+}
+
+// Scans a block of the input. The lists of the job use move-to-front, like
+// the ones of the sequential scan, so merging them in order gives the same
+// result.
+static void scan_block(Scan *s, Job *j, Worker *w) {
+  Dictionary *d = s->reloader ? reloader_enter(s->reloader, w->id) : s->dict;
+  offenses_reserve(j->offenses, d); // d may be a newer generation
+  scan_text(j->buf, j->n, d, w->ctx, j->offenses);
+  if (s->reloader) {
+    reloader_exit(s->reloader, w->id);
+  }
+}
+
+// The worker threads take blocks in the order they were read until the input
+// ends and every block was taken.
+static void *work(void *arg) {
+  Worker *w = (Worker *)arg;
+  Scan *s = w->scan;
+  while (true) {
+    pthread_mutex_lock(&s->lock);
+    while (s->n_taken == s->n_read && !s->eof) {
+      pthread_cond_wait(&s->work, &s->lock);
+    }
+    if (s->n_taken == s->n_read) {
+      pthread_mutex_unlock(&s->lock);
+      break;
+    }
+    Job *j = &s->jobs[s->n_taken % s->n_jobs];
+    s->n_taken += 1;
+    pthread_mutex_unlock(&s->lock);
+
+    scan_block(s, j, w);
+
+    pthread_mutex_lock(&s->lock);
+    j->done = true;
+    pthread_cond_broadcast(&s->done);
+    pthread_mutex_unlock(&s->lock);
+  }
+  return NULL;
+}
+
+// Fills the block of the job with the bytes carried over from the last block
+// and then with the input. The block is cut after the last character that
+// can't be in a word, so no word is split between two blocks, and the rest is
+// carried over. The input is read from in, or from f if in is NULL. Returns
+// false once the input ended.
+static bool read_block(Job *j, char *carry, uint64_t *n_carry, FILE *f,
+                       Input *in) {
+  memcpy(j->buf, carry, *n_carry);
+  uint64_t n = *n_carry;
+  n += in ? input_read(in, j->buf + n, SCAN_BLOCK - n)
+          : fread(j->buf + n, 1, SCAN_BLOCK - n, f);
+  bool more = n == SCAN_BLOCK;
+  uint64_t cut = n;
+  if (more) {
+    while (cut > 0 && word_char(j->buf[cut - 1])) {
+      cut -= 1;
+    }
+    if (cut == 0) { // The whole block is one word
+      cut = n;
+    }
+  }
+  *n_carry = n - cut;
+  memcpy(carry, j->buf + cut, *n_carry);
+  j->buf[cut] = '\0';
+  j->n = cut;
+  return more;
+}
+
+// Deletes the blocks of the ring and their offenses, and the contexts of the
+// workers
+static void scan_free(Job *jobs, uint32_t n_jobs, Worker *workers,
+                      uint32_t n_threads) {
+  for (uint32_t i = 0; jobs && i < n_jobs; i += 1) {
+    free(jobs[i].buf);
+    offenses_delete(&jobs[i].offenses);
+  }
+  for (uint32_t i = 0; workers && i < n_threads; i += 1) {
+    scan_context_delete(&workers[i].ctx);
+  }
+  free(jobs);
+  free(workers);
+}
+
+// Scans f (or in, if it isn't NULL) with n_threads threads that share the
+// dictionary d (or the current generation of r, with reader slots 0 to
+// n_threads - 1). The main thread reads the input in blocks and merges the
+// offenses of each block into o in input order, so they end up the same as
+// with the sequential scan. Lookups don't write to the dictionary:
+// move-to-front is not used, and the stats of the workers are added to total
+// at the end. Each worker has a token cache with cache_entries entries (none
+// if 0). All the memory is allocated before the threads start, and reused
+// from block to block.
+// Returns 1 if the memory couldn't be allocated or a thread couldn't be
+// started (once the threads that were are joined). Else, return 0.
+int scan_parallel(Dictionary *d, Reloader *r, uint32_t n_threads,
+                  uint32_t cache_entries, FILE *f, Input *in, Offenses *o,
+                  Counters *total) {
+  Scan s;
+  s.n_jobs = n_threads * JOBS_PER_THREAD;
+  s.n_read = s.n_taken = 0;
+  s.eof = false;
+  s.dict = d;
+  s.reloader = r;
+  s.jobs = (Job *)calloc(s.n_jobs, sizeof(Job));
+  Worker *workers = (Worker *)calloc(n_threads, sizeof(Worker));
+  char *carry = (char *)malloc(SCAN_BLOCK);
+  bool ok = s.jobs && workers && carry;
+  for (uint32_t i = 0; ok && i < s.n_jobs; i += 1) {
+    s.jobs[i].buf = (char *)malloc(SCAN_BLOCK + 1 + CPU_SPAN_PAD);
+    s.jobs[i].offenses = offenses_create(d);
+    ok = s.jobs[i].buf && s.jobs[i].offenses;
+  }
+  for (uint32_t i = 0; ok && i < n_threads; i += 1) {
+    workers[i].ctx = scan_context_create(cache_entries);
+    ok = workers[i].ctx != NULL;
+  }
+  if (!ok) {
+    scan_free(s.jobs, s.n_jobs, workers, n_threads);
+    free(carry);
+    return 1;
+  }
+
+  pthread_mutex_init(&s.lock, NULL);
+  pthread_cond_init(&s.work, NULL);
+  pthread_cond_init(&s.done, NULL);
+  uint32_t started = 0;
+  while (started < n_threads) {
+    workers[started].scan = &s;
+    workers[started].id = started;
+    if (pthread_create(&workers[started].thread, NULL, work,
+                       &workers[started]) != 0) {
+      break;
+    }
+    started += 1;
+  }
+  // If a thread couldn't be started, the ones that were stop right away
+  if (started < n_threads) {
+    pthread_mutex_lock(&s.lock);
+    s.eof = true;
+    pthread_cond_broadcast(&s.work);
+    pthread_mutex_unlock(&s.lock);
+  }
+
+  uint64_t n_carry = 0;
+  uint64_t n_merged = 0;
+  bool eof = started < n_threads;
+  while (!eof || n_merged < s.n_read) {
+    // Read the next block while there is a free one in the ring
+    if (!eof && s.n_read - n_merged < s.n_jobs) {
+      Job *j = &s.jobs[s.n_read % s.n_jobs];
+      j->done = false;
+      eof = !read_block(j, carry, &n_carry, f, in);
+      pthread_mutex_lock(&s.lock);
+      if (j->n > 0) {
+        s.n_read += 1;
+      }
+      s.eof = eof;
+      pthread_cond_broadcast(&s.work);
+      pthread_mutex_unlock(&s.lock);
+      continue;
+    }
+    // Else, merge the oldest block once it was scanned
+    Job *j = &s.jobs[n_merged % s.n_jobs];
+    pthread_mutex_lock(&s.lock);
+    while (!j->done) {
+      pthread_cond_wait(&s.done, &s.lock);
+    }
+    pthread_mutex_unlock(&s.lock);
+    ll_merge(o->thought_crime, j->offenses->thought_crime);
+    ll_merge(o->rightspeak, j->offenses->rightspeak);
+    offenses_clear(j->offenses);
+    n_merged += 1;
+  }
+
+  for (uint32_t i = 0; i < started; i += 1) {
+    pthread_join(workers[i].thread, NULL);
+    counters_add(total, scan_counters(workers[i].ctx));
+  }
+  pthread_cond_destroy(&s.done);
+  pthread_cond_destroy(&s.work);
+  pthread_mutex_destroy(&s.lock);
+  scan_free(s.jobs, s.n_jobs, workers, n_threads);
+  free(carry);
+  return started < n_threads;
+}
@@ -0,0 +1,65 @@
+#ifndef __SCAN_H__
+#define __SCAN_H__
+
+#include "arena.h"
+#include "dh.h"
+#include "dict.h"
+#include "input.h"
+#include "ll.h"
+#include "reload.h"
+#include "stats.h"
+#include "tc.h"
+#include "trie.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define MAX_SCAN_THREADS 256
+
+// The offenses found in a text: the badspeak words, and the oldspeak words
+// with their newspeak. The nodes of both lists live in arena.
+typedef struct Offenses Offenses;
+
+struct Offenses {
+    LinkedList *thought_crime;
+    LinkedList *rightspeak;
+    Arena *arena;
+};
+
+typedef struct ScanContext ScanContext;
+
+Offenses *offenses_create(Dictionary *d);
+
+bool offenses_reserve(Offenses *o, Dictionary *d);
+
+bool offenses_headroom(Offenses *o);
+
+uint32_t offense_fp(char *word, uint32_t len);
+
+void offenses_delete(Offenses **o);
+
+void offenses_clear(Offenses *o);
+
+ScanContext *scan_context_create(uint32_t cache_entries);
+
+void scan_context_delete(ScanContext **ctx);
+
+char *scan_word(ScanContext *ctx);
+
+TokenCache *scan_cache(ScanContext *ctx);
+
+Counters *scan_counters(ScanContext *ctx);
+
+Node *scan_trie(ScanContext *ctx, Trie *t, char *word, uint32_t len);
+
+Node *scan_disk(ScanContext *ctx, DiskHash *dh, char *word, uint32_t len);
+
+void scan_text(char *text, uint64_t n, Dictionary *d, ScanContext *ctx,
+               Offenses *o);
+
+int scan_parallel(Dictionary *d, Reloader *r, uint32_t n_threads,
+                  uint32_t cache_entries, FILE *f, Input *in, Offenses *o,
+                  Counters *total);
+
+#endif
@@ -0,0 +1,40 @@
+#include "seed.h"
+#include <stdatomic.h>
+#include <stdint.h>
+#include <sys/random.h>
+#include <time.h>
+#include <unistd.h>
+
+// The salts of the Bloom filter and hash table are drawn from a splitmix64
+// stream started at a per-process seed, so an adversary can't know where words
+// land. seed is the starting point (printed with the statistics so a run can be
+// repeated with --seed) and state is the position in the stream, shared by all
+// threads.
+static uint64_t seed = 0;
+static _Atomic uint64_t state = 0;
+
+// Sets the seed, restarting the stream of salts
+void seed_set(uint64_t s) {
+  seed = s;
+  atomic_store(&state, s);
+}
+
+// Sets a random seed from the kernel (or the time and pid if that fails)
+void seed_random(void) {
+  uint64_t s;
+  if (getrandom(&s, sizeof(s), 0) != sizeof(s)) {
+    s = (uint64_t)time(NULL) ^ ((uint64_t)getpid() << 32);
+  }
+  seed_set(s);
+}
+
+// Returns the seed that the stream of salts started at
+uint64_t seed_get(void) { return seed; }
+
+// Returns the next salt of the stream (splitmix64)
+uint64_t seed_next(void) {
+  uint64_t z = atomic_fetch_add(&state, 0x9e3779b97f4a7c15) + 0x9e3779b97f4a7c15;
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+  return z ^ (z >> 31);
+}
@@ -0,0 +1,14 @@
+#ifndef __SEED_H__
+#define __SEED_H__
+
+#include <stdint.h>
+
+void seed_set(uint64_t seed);
+
+void seed_random(void);
+
+uint64_t seed_get(void);
+
+uint64_t seed_next(void);
+
+#endif
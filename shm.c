@@ -0,0 +1,166 @@
+#include "shm.h"
+#include <fcntl.h>
+#include <stdatomic.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Times a worker retries when the generation it read was replaced (and
+// unlinked) before it could open it
+#define SHM_RETRIES 8
+
+// Defines the control segment of a shared dictionary, named /name. The
+// generations are the segments /name.1, /name.2, ..., each holding a Trie
+// image. next is the last generation number handed to a loader, and current
+// the generation workers should attach to (0 if none was published yet).
+typedef struct Control Control;
+
+struct Control {
+  _Atomic uint64_t next;
+  _Atomic uint64_t current;
+};
+
+// Writes the name of the control segment (generation 0) or of a generation
+// into buf. Returns false if name is too long or holds a /.
+static bool segment_name(char *buf, char *name, uint64_t generation) {
+  if (strlen(name) == 0 || strlen(name) > SHM_NAME_MAX ||
+      strchr(name, '/') != NULL) {
+    return false;
+  }
+  if (generation == 0) {
+    snprintf(buf, SHM_NAME_MAX + 32, "/%s", name);
+  } else {
+    snprintf(buf, SHM_NAME_MAX + 32, "/%s.%lu", name, generation);
+  }
+  return true;
+}
+
+// Maps the control segment of name, creating it if create is set (else it is
+// mapped read-only). Returns NULL if it can't be opened or mapped.
+static Control *control_map(char *name, bool create) {
+  char path[SHM_NAME_MAX + 32];
+  if (!segment_name(path, name, 0)) {
+    return NULL;
+  }
+  int fd = create ? shm_open(path, O_RDWR | O_CREAT, 0644)
+                  : shm_open(path, O_RDONLY, 0);
+  if (fd < 0) {
+    return NULL;
+  }
+  struct stat st;
+  void *map = MAP_FAILED;
+  // A new segment is empty, and zero bytes are generation 0
+  if (fstat(fd, &st) == 0 &&
+      ((uint64_t)st.st_size >= sizeof(Control) ||
+       (create && ftruncate(fd, sizeof(Control)) == 0))) {
+    map = mmap(NULL, sizeof(Control), create ? PROT_READ | PROT_WRITE : PROT_READ,
+               MAP_SHARED, fd, 0);
+  }
+  close(fd);
+  return map == MAP_FAILED ? NULL : (Control *)map;
+}
+
+// Publishes the Trie t as the next generation of the shared dictionary name:
+// its image is copied into a new segment, which then becomes current. The
+// previous generation is unlinked; workers that mapped it keep using it until
+// they attach to the new one. Several loaders can publish at once, the
+// highest generation wins (a lower one is unlinked right away). Sets
+// generation to the one that was published.
+// Returns false if the segments couldn't be created.
+bool shm_publish(char *name, Trie *t, uint64_t *generation) {
+  Control *c = control_map(name, true);
+  if (c == NULL) {
+    return false;
+  }
+  uint64_t g = atomic_fetch_add(&c->next, 1) + 1;
+  char path[SHM_NAME_MAX + 32];
+  segment_name(path, name, g);
+  int fd = shm_open(path, O_RDWR | O_CREAT | O_EXCL, 0444);
+  bool ok = fd >= 0 && ftruncate(fd, trie_size(t)) == 0;
+  void *map = MAP_FAILED;
+  if (ok) {
+    map = mmap(NULL, trie_size(t), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ok = map != MAP_FAILED;
+  }
+  if (ok) {
+    memcpy(map, trie_image(t), trie_size(t));
+    munmap(map, trie_size(t));
+  }
+  if (fd >= 0) {
+    close(fd);
+  }
+  if (!ok) {
+    shm_unlink(path);
+    munmap(c, sizeof(Control));
+    return false;
+  }
+  // Only replaces an older generation, so a slow loader can't go back in time
+  uint64_t old = atomic_load(&c->current);
+  while (old < g && !atomic_compare_exchange_weak(&c->current, &old, g)) {
+  }
+  uint64_t stale = old < g ? old : g;
+  if (stale != 0) {
+    segment_name(path, name, stale);
+    shm_unlink(path);
+  }
+  munmap(c, sizeof(Control));
+  *generation = g;
+  return true;
+}
+
+// Maps the current generation of the shared dictionary name read-only, so all
+// the workers that attach to it share one copy. Sets generation to the one
+// that was mapped. Returns NULL if nothing was published under name or it
+// can't be mapped.
+Trie *shm_attach(char *name, uint64_t *generation) {
+  Control *c = control_map(name, false);
+  if (c == NULL) {
+    return NULL;
+  }
+  Trie *t = NULL;
+  for (uint32_t i = 0; t == NULL && i < SHM_RETRIES; i += 1) {
+    uint64_t g = atomic_load(&c->current);
+    char path[SHM_NAME_MAX + 32];
+    segment_name(path, name, g);
+    int fd = g == 0 ? -1 : shm_open(path, O_RDONLY, 0);
+    if (fd >= 0) {
+      t = trie_map(fd);
+      close(fd);
+      *generation = g;
+    } else if (g == 0 || g == atomic_load(&c->current)) {
+      break; // Not a race with a loader, so retrying won't help
+    }
+  }
+  munmap(c, sizeof(Control));
+  return t;
+}
+
+// Returns the current generation of the shared dictionary name (0 if none was
+// published)
+uint64_t shm_generation(char *name) {
+  Control *c = control_map(name, false);
+  if (c == NULL) {
+    return 0;
+  }
+  uint64_t g = atomic_load(&c->current);
+  munmap(c, sizeof(Control));
+  return g;
+}
+
+// Unlinks the control segment and the current generation of name. Workers
+// that are attached keep their mapping. Returns false if there was nothing to
+// remove.
+bool shm_remove(char *name) {
+  uint64_t g = shm_generation(name);
+  char path[SHM_NAME_MAX + 32];
+  if (!segment_name(path, name, 0) || shm_unlink(path) != 0) {
+    return false;
+  }
+  if (g != 0) {
+    segment_name(path, name, g);
+    shm_unlink(path);
+  }
+  return true;
+}
@@ -0,0 +1,20 @@
+#ifndef __SHM_H__
+#define __SHM_H__
+
+#include "trie.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Longest name of a shared dictionary (without the / and generation)
+#define SHM_NAME_MAX 200
+
+bool shm_publish(char *name, Trie *t, uint64_t *generation);
+
+Trie *shm_attach(char *name, uint64_t *generation);
+
+uint64_t shm_generation(char *name);
+
+bool shm_remove(char *name);
+
+#endif
@@ -0,0 +1,51 @@
+#include "stats.h"
+
+#include <string.h>
+
+// Sets all the counters to 0
+void counters_clear(Counters *c) { memset(c, 0, sizeof(Counters)); }
+
+// Adds the counters of c to total. Used to aggregate the counters of all the
+// threads once they are done.
+void counters_add(Counters *total, Counters *c) {
+  total->bf_hits += c->bf_hits;
+  total->bf_misses += c->bf_misses;
+  total->bf_bits_examined += c->bf_bits_examined;
+  total->ht_hits += c->ht_hits;
+  total->ht_misses += c->ht_misses;
+  total->ht_examined += c->ht_examined;
+  total->cache_hits += c->cache_hits;
+  total->cache_misses += c->cache_misses;
+  total->result_hits += c->result_hits;
+  total->result_misses += c->result_misses;
+  total->tokens += c->tokens;
+  total->bytes += c->bytes;
+  total->trie_hits += c->trie_hits;
+  total->trie_misses += c->trie_misses;
+  total->disk_hits += c->disk_hits;
+  total->disk_misses += c->disk_misses;
+  total->disk_filtered += c->disk_filtered;
+  total->disk_pages += c->disk_pages;
+}
+
+// Returns a / b, or 0 if b is 0
+static double ratio(double a, double b) { return b == 0 ? 0 : a / b; }
+
+// Computes the derived metrics of a Snapshot from its counters and figures.
+// n_hashes is the number of bits a probe of the Bloom filter examines when it
+// hits, so the bits examined per miss only count the probes that missed.
+// The false positive rate is the share of Bloom filter hits that the hash
+// table then didn't find.
+void snapshot_derive(Snapshot *s, uint32_t n_hashes) {
+  Counters *c = &s->counters;
+  double seconds = s->elapsed_ns / 1e9;
+  s->bits_per_miss = ratio((double)c->bf_bits_examined -
+                               (double)n_hashes * c->bf_hits,
+                           c->bf_misses);
+  s->false_positives = ratio(c->ht_misses, c->bf_hits);
+  s->seek_length = ratio(c->ht_examined, c->ht_hits + c->ht_misses);
+  s->bf_load = ratio(s->bf_set, s->bf_size);
+  s->cache_hit_rate = ratio(c->cache_hits, c->cache_hits + c->cache_misses);
+  s->tokens_per_sec = ratio(c->tokens, seconds);
+  s->bytes_per_sec = ratio(c->bytes, seconds);
+}
@@ -0,0 +1,71 @@
+#ifndef __STATS_H__
+#define __STATS_H__
+
+#include <stdint.h>
+
+// The size of a cache line. Counters of different threads are kept at least
+// this far apart so that they never share a line.
+#define CACHE_LINE 64
+
+typedef struct Counters Counters;
+
+// Lookup statistics of one thread. Each thread that scans words at the same
+// time as others keeps its own Counters and passes it to bf_probe_r and
+// ht_lookup_r, so the shared BloomFilter and HashTable are never written to.
+struct Counters {
+  _Alignas(CACHE_LINE) uint64_t bf_hits;
+  uint64_t bf_misses;
+  uint64_t bf_bits_examined;
+  uint64_t ht_hits;
+  uint64_t ht_misses;
+  uint64_t ht_examined;
+  uint64_t cache_hits;
+  uint64_t cache_misses;
+  uint64_t result_hits;
+  uint64_t result_misses;
+  uint64_t tokens;
+  uint64_t bytes;
+  uint64_t trie_hits;
+  uint64_t trie_misses;
+  uint64_t disk_hits;
+  uint64_t disk_misses;
+  uint64_t disk_filtered;
+  uint64_t disk_pages;
+};
+
+typedef struct Snapshot Snapshot;
+
+// Statistics of a whole scan, gathered in one place: the counters of every
+// thread added up, the figures of the dictionary it was scanned with, and the
+// metrics derived from both by snapshot_derive.
+struct Snapshot {
+  Counters counters;
+  uint64_t bf_keys;
+  uint64_t bf_size;
+  uint64_t bf_set;
+  uint64_t ht_keys;
+  uint64_t ht_max_chain;
+  uint64_t ht_rehashes;
+  uint64_t trie_keys;
+  uint64_t trie_cells;
+  uint64_t trie_size;
+  uint64_t disk_keys;
+  uint64_t disk_buckets;
+  uint64_t disk_size;
+  uint64_t elapsed_ns;
+  double bits_per_miss;
+  double false_positives;
+  double seek_length;
+  double bf_load;
+  double cache_hit_rate;
+  double tokens_per_sec;
+  double bytes_per_sec;
+};
+
+void counters_clear(Counters *c);
+
+void counters_add(Counters *total, Counters *c);
+
+void snapshot_derive(Snapshot *s, uint32_t n_hashes);
+
+#endif
@@ -0,0 +1,136 @@
+#include "tc.h"
+#include "seed.h"
+#include "stats.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#define TC_WAYS 2
+
+// One set of the cache: two tokens (their first TC_KEY bytes, zero padded,
+// and their length) with the verdict for each, which is the Node of the word
+// in the HashTable or NULL if it's not in the dictionary. A length of 0 marks
+// an empty way. old is the way to replace next. A set fills one cache line.
+typedef struct TokenSet TokenSet;
+
+struct TokenSet {
+  _Alignas(CACHE_LINE) uint64_t key[TC_WAYS][TC_KEY / 8];
+  Node *node[TC_WAYS];
+  uint32_t len[TC_WAYS];
+  uint8_t old;
+};
+
+// Defines what members/fields the TokenCache has.
+// sets is an array of 2^bits sets. mul is a random odd number that spreads
+// the tokens over the sets. dict is the id of the Dictionary the verdicts came
+// from. hits and misses count the lookups.
+typedef struct TokenCache TokenCache;
+
+struct TokenCache {
+  TokenSet *sets;
+  uint32_t bits;
+  uint64_t mul;
+  uint64_t dict;
+  uint64_t hits;
+  uint64_t misses;
+};
+
+// The constructor for the TokenCache. Creates a 2-way set associative cache
+// with room for at least the given number of tokens (rounded up to a power of
+// two). Returns NULL if entries is 0 or the memory couldn't be allocated.
+TokenCache *tc_create(uint32_t entries) {
+  if (entries == 0) {
+    return NULL;
+  }
+  TokenCache *tc = (TokenCache *)malloc(sizeof(TokenCache));
+  if (tc) {
+    tc->bits = 0;
+    while (((uint64_t)TC_WAYS << tc->bits) < entries) {
+      tc->bits += 1;
+    }
+    tc->mul = seed_next() | 1;
+    tc->dict = 0;
+    tc->hits = tc->misses = 0;
+    size_t size = ((size_t)1 << tc->bits) * sizeof(TokenSet);
+    tc->sets = (TokenSet *)aligned_alloc(CACHE_LINE, size);
+    if (tc->sets == NULL) {
+      free(tc);
+      return NULL;
+    }
+    memset(tc->sets, 0, size);
+  }
+  return tc;
+}
+
+// The destructor for a TokenCache.
+void tc_delete(TokenCache **tc) {
+  if (*tc) {
+    free((*tc)->sets);
+    free(*tc);
+    *tc = NULL;
+  }
+}
+
+// Tells the cache which Dictionary the next verdicts are for. If it's not the
+// one the cached verdicts came from, they are all dropped.
+void tc_use(TokenCache *tc, uint64_t dict) {
+  if (tc->dict != dict) {
+    memset(tc->sets, 0, ((size_t)1 << tc->bits) * sizeof(TokenSet));
+    tc->dict = dict;
+  }
+}
+
+// Returns the set a token goes in. This is a multiply and a shift, which is
+// much cheaper than the hashes of the BloomFilter.
+static inline TokenSet *set_of(TokenCache *tc, uint64_t *k, uint32_t len) {
+  uint64_t h = (k[0] ^ (k[1] * 0x9e3779b97f4a7c15ULL) ^ len) * tc->mul;
+  return &tc->sets[tc->bits ? h >> (64 - tc->bits) : 0];
+}
+
+// Looks for word in the cache. word has to be zero padded to NODE_INLINE
+// bytes and len is its length. If it's there, sets n to its verdict (NULL if
+// it's not in the dictionary) and returns true. Else, return false. A word
+// too long to be cached is never there, and counts as a miss like any other.
+bool tc_lookup(TokenCache *tc, char *word, uint32_t len, Node **n) {
+  if (len >= TC_KEY) {
+    tc->misses += 1;
+    return false;
+  }
+  uint64_t k[TC_KEY / 8];
+  memcpy(k, word, TC_KEY);
+  TokenSet *s = set_of(tc, k, len);
+  for (uint32_t w = 0; w < TC_WAYS; w += 1) {
+    uint64_t diff = (s->key[w][0] ^ k[0]) | (s->key[w][1] ^ k[1]);
+    if (s->len[w] == len && diff == 0) {
+      s->old = w ^ 1; // The other way is now the least recently used one
+      *n = s->node[w];
+      tc->hits += 1;
+      return true;
+    }
+  }
+  tc->misses += 1;
+  return false;
+}
+
+// Remembers the verdict n for word (same arguments as tc_lookup), replacing
+// the least recently used token of its set. Words that are too long to be
+// cached are ignored.
+void tc_insert(TokenCache *tc, char *word, uint32_t len, Node *n) {
+  if (len >= TC_KEY || len == 0) {
+    return;
+  }
+  uint64_t k[TC_KEY / 8];
+  memcpy(k, word, TC_KEY);
+  TokenSet *s = set_of(tc, k, len);
+  uint32_t w = s->old;
+  memcpy(s->key[w], k, TC_KEY);
+  s->len[w] = len;
+  s->node[w] = n;
+  s->old = w ^ 1;
+}
+
+// Sets the number of lookups that were and weren't in the cache
+void tc_stats(TokenCache *tc, uint64_t *hits, uint64_t *misses) {
+  *hits = tc->hits;
+  *misses = tc->misses;
+}
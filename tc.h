@@ -0,0 +1,28 @@
+#ifndef __TC_H__
+#define __TC_H__
+
+#include "node.h"
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Tokens shorter than TC_KEY bytes can be cached
+#define TC_KEY 16
+
+#define TC_DEFAULT_ENTRIES 4096
+
+typedef struct TokenCache TokenCache;
+
+TokenCache *tc_create(uint32_t entries);
+
+void tc_delete(TokenCache **tc);
+
+void tc_use(TokenCache *tc, uint64_t dict);
+
+bool tc_lookup(TokenCache *tc, char *word, uint32_t len, Node **n);
+
+void tc_insert(TokenCache *tc, char *word, uint32_t len, Node *n);
+
+void tc_stats(TokenCache *tc, uint64_t *hits, uint64_t *misses);
+
+#endif
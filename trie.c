@@ -0,0 +1,679 @@
+#include "trie.h"
+#include "arena.h"
+#include "dict.h"
+#include "norm.h"
+#include "parser.h"
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#define TRIE_MAGIC "BHTRIE3"
+// A free cell that was tried this many times as the first child of a node is
+// dropped from the free list, so the search for a base doesn't keep starting
+// at the crowded front of the array
+#define TRIE_TRIES 32
+
+// Defines what members/fields a Cell of the double array has.
+// The children of a node s are the cells base + code whose check is s. The
+// cell of code 0 marks the end of a word, and its base holds -(value + 1),
+// where value is 0 for badspeak or the newspeak id plus 1.
+// An empty cell has a check of -1.
+typedef struct Cell Cell;
+
+struct Cell {
+  int32_t base;
+  int32_t check;
+};
+
+// Defines the header of a Trie image, which is the same in memory and on disk.
+// The image is the header, then n_cells Cells, then the offset of each
+// front-coded block of newspeak strings in the pool, then the pool.
+// node_bytes is how much an arena needs to copy every word (with its newspeak)
+// into Nodes, like the HashTable does. norm is the normalization the words
+// were read with (the flags of the Normalizer).
+typedef struct Header Header;
+
+struct Header {
+  char magic[8];
+  uint64_t norm;
+  uint64_t n_cells;
+  uint64_t n_keys;
+  uint64_t n_values;
+  uint64_t n_blocks;
+  uint64_t pool_size;
+  uint64_t node_bytes;
+  uint64_t size;
+};
+
+// Defines what members/fields the Trie has.
+// codes maps each byte to its code (0 if it can't be in a word). header points
+// at the image, which is either malloc'd (owned), mmap'd from a file (mapped)
+// or compiled into the program, and cells, blocks and pool point into it.
+struct Trie {
+  uint8_t codes[256];
+  Header *header;
+  Cell *cells;
+  uint32_t *blocks;
+  uint8_t *pool;
+  bool owned;
+  bool mapped;
+};
+
+// An oldspeak and its newspeak (NULL for badspeak) as read from the files.
+// order is the position it was read at, so the first of two equal oldspeak
+// wins, as it does in the HashTable.
+typedef struct Pair Pair;
+
+struct Pair {
+  char *oldspeak;
+  char *newspeak;
+  uint32_t len;
+  uint32_t order;
+  uint32_t value;
+};
+
+// Defines what members/fields the Builder has.
+// The cells that are still empty form a circular list (next and prev, -1 for
+// cells not in it), starting at free_head. tries counts how often each free
+// cell was tried as the first child of a node.
+typedef struct Builder Builder;
+
+struct Builder {
+  uint8_t codes[256];
+  Cell *cells;
+  int32_t *next;
+  int32_t *prev;
+  uint8_t *tries;
+  uint32_t cap;
+  int32_t free_head;
+  uint32_t top; // One past the highest base + TRIE_CODES used so far
+  Pair *pairs;
+};
+
+// Fills codes with the code of every byte. The codes keep the order of the
+// bytes, so words sorted with strcmp are sorted by code too.
+static void fill_codes(uint8_t *codes) {
+  memset(codes, 0, 256);
+  uint8_t c = 1;
+  codes['\''] = c++;
+  codes['-'] = c++;
+  for (char d = '0'; d <= '9'; d += 1) {
+    codes[(uint8_t)d] = c++;
+  }
+  for (char l = 'a'; l <= 'z'; l += 1) {
+    codes[(uint8_t)l] = c++;
+  }
+  for (uint32_t b = 0x80; b <= 0xff; b += 1) {
+    codes[b] = c++;
+  }
+}
+
+// Removes cell i from the free list
+static void unlink_free(Builder *b, int32_t i) {
+  if (b->next[i] < 0) {
+    return;
+  }
+  if (b->next[i] == i) {
+    b->free_head = -1;
+  } else {
+    b->next[b->prev[i]] = b->next[i];
+    b->prev[b->next[i]] = b->prev[i];
+    if (b->free_head == i) {
+      b->free_head = b->next[i];
+    }
+  }
+  b->next[i] = b->prev[i] = -1;
+}
+
+// Grows the arrays of the Builder to at least cap cells. The new cells are
+// empty and added at the end of the free list. Returns false if the memory
+// couldn't be allocated.
+static bool grow(Builder *b, uint64_t cap) {
+  if (cap <= b->cap) {
+    return true;
+  }
+  uint64_t n = b->cap ? b->cap : 1024;
+  while (n < cap) {
+    n *= 2;
+  }
+  if (n > INT32_MAX) {
+    return false;
+  }
+  Cell *cells = (Cell *)realloc(b->cells, sizeof(Cell) * n);
+  if (cells) {
+    b->cells = cells;
+  }
+  int32_t *next = (int32_t *)realloc(b->next, sizeof(int32_t) * n);
+  if (next) {
+    b->next = next;
+  }
+  int32_t *prev = (int32_t *)realloc(b->prev, sizeof(int32_t) * n);
+  if (prev) {
+    b->prev = prev;
+  }
+  uint8_t *tries = (uint8_t *)realloc(b->tries, n);
+  if (tries) {
+    b->tries = tries;
+  }
+  if (cells == NULL || next == NULL || prev == NULL || tries == NULL) {
+    return false;
+  }
+  for (uint32_t i = b->cap; i < n; i += 1) {
+    b->cells[i].base = 0;
+    b->cells[i].check = -1;
+    b->tries[i] = 0;
+    if (i == 0) { // The root is never free
+      b->next[i] = b->prev[i] = -1;
+      continue;
+    }
+    if (b->free_head < 0) {
+      b->free_head = b->next[i] = b->prev[i] = i;
+    } else { // Insert before the head, which is the end of the list
+      int32_t last = b->prev[b->free_head];
+      b->next[last] = i;
+      b->prev[i] = last;
+      b->next[i] = b->free_head;
+      b->prev[b->free_head] = i;
+    }
+  }
+  b->cap = n;
+  return true;
+}
+
+// Returns true if every child code of a node fits at base
+static bool fits(Builder *b, int32_t base, uint8_t *codes, uint32_t k) {
+  for (uint32_t i = 0; i < k; i += 1) {
+    if (b->cells[base + codes[i]].check >= 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Finds a base where the k child codes of a node (sorted) all land on empty
+// cells, growing the arrays when there is none. Returns -1 if the memory
+// couldn't be allocated.
+static int32_t find_base(Builder *b, uint8_t *codes, uint32_t k) {
+  if (b->free_head < 0 && !grow(b, (uint64_t)b->cap * 2)) {
+    return -1;
+  }
+  int32_t f = b->free_head;
+  while (true) {
+    int32_t base = f - codes[0];
+    if (base >= 1) {
+      if (!grow(b, (uint64_t)base + TRIE_CODES)) {
+        return -1;
+      }
+      if (fits(b, base, codes, k)) {
+        return base;
+      }
+    }
+    // Tried every free cell, so make more
+    if (b->next[f] == b->free_head && !grow(b, (uint64_t)b->cap * 2)) {
+      return -1;
+    }
+    int32_t next = b->next[f];
+    if (f == b->free_head && ++b->tries[f] >= TRIE_TRIES) {
+      unlink_free(b, f);
+    }
+    f = next;
+  }
+}
+
+// Returns the code of the character of key p at depth (0 past its end)
+static uint8_t code_at(Builder *b, Pair *p, uint32_t depth) {
+  return depth < p->len ? b->codes[(uint8_t)p->oldspeak[depth]] : 0;
+}
+
+// Places the children of node s, which are the words pairs[lo..hi) that share
+// their first depth characters, then places theirs. Returns false if the
+// memory couldn't be allocated.
+static bool place(Builder *b, int32_t s, uint32_t lo, uint32_t hi,
+                  uint32_t depth) {
+  uint8_t codes[TRIE_CODES];
+  uint32_t starts[TRIE_CODES + 1];
+  uint32_t k = 0;
+  for (uint32_t i = lo; i < hi; i += 1) {
+    uint8_t c = code_at(b, &b->pairs[i], depth);
+    if (k == 0 || codes[k - 1] != c) {
+      codes[k] = c;
+      starts[k] = i;
+      k += 1;
+    }
+  }
+  starts[k] = hi;
+  int32_t base = find_base(b, codes, k);
+  if (base < 0) {
+    return false;
+  }
+  b->cells[s].base = base;
+  if ((uint32_t)base + TRIE_CODES > b->top) {
+    b->top = base + TRIE_CODES;
+  }
+  // Takes all the cells of the children before placing any grandchild
+  for (uint32_t i = 0; i < k; i += 1) {
+    unlink_free(b, base + codes[i]);
+    b->cells[base + codes[i]].check = s;
+  }
+  for (uint32_t i = 0; i < k; i += 1) {
+    int32_t t = base + codes[i];
+    if (codes[i] == 0) { // Only one word ends here, since keys are unique
+      b->cells[t].base = -(int32_t)b->pairs[starts[i]].value - 1;
+    } else if (!place(b, t, starts[i], starts[i + 1], depth + 1)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Orders pairs by oldspeak, then by the order they were read in
+static int compare_pairs(const void *x, const void *y) {
+  const Pair *a = (const Pair *)x;
+  const Pair *b = (const Pair *)y;
+  int c = strcmp(a->oldspeak, b->oldspeak);
+  if (c != 0) {
+    return c;
+  }
+  return a->order < b->order ? -1 : a->order > b->order;
+}
+
+// Orders newspeak strings
+static int compare_strings(const void *x, const void *y) {
+  return strcmp(*(char *const *)x, *(char *const *)y);
+}
+
+// Appends a 16-bit length to the pool
+static uint64_t put16(uint8_t *pool, uint64_t at, uint32_t v) {
+  uint16_t w = v;
+  memcpy(pool + at, &w, sizeof(w));
+  return at + sizeof(w);
+}
+
+// Reads a 16-bit length from the pool
+static uint32_t get16(uint8_t *p) {
+  uint16_t w;
+  memcpy(&w, p, sizeof(w));
+  return w;
+}
+
+// Points the Trie at its image
+static void attach(Trie *t, Header *h, bool owned, bool mapped) {
+  fill_codes(t->codes);
+  t->header = h;
+  t->cells = (Cell *)(h + 1);
+  t->blocks = (uint32_t *)(t->cells + h->n_cells);
+  t->pool = (uint8_t *)(t->blocks + h->n_blocks);
+  t->owned = owned;
+  t->mapped = mapped;
+}
+
+// Returns true if the size bytes at h look like a Trie image whose words were
+// normalized like the text will be: the magic, the flags of the Normalizer,
+// and sizes that add up. The rest of the image is trusted like the dictionary
+// files are.
+static bool valid(Header *h, uint64_t size) {
+  return size >= sizeof(Header) &&
+         memcmp(h->magic, TRIE_MAGIC, sizeof(h->magic)) == 0 &&
+         h->norm == normalizer.flags &&
+         h->size == size && h->n_cells > TRIE_CODES &&
+         h->n_cells < INT32_MAX && h->n_blocks <= h->n_values &&
+         sizeof(Header) + sizeof(Cell) * h->n_cells +
+                 sizeof(uint32_t) * h->n_blocks + h->pool_size ==
+             h->size;
+}
+
+// Reads the words of a dictionary file into the pairs. With pairs set, every
+// word is followed by its newspeak. Returns false if the file can't be opened
+// or the memory couldn't be allocated.
+static bool read_pairs(char *file, bool pairs, Pair **list, uint32_t *n,
+                       uint32_t *cap, Arena *arena) {
+  FILE *f = fopen(file, "r");
+  if (f == NULL) {
+    return false;
+  }
+  Parser *p = parser_create(f);
+  char oldspeak[MAX_PARSER_LINE_LENGTH + 1] = "";
+  char newspeak[MAX_PARSER_LINE_LENGTH + 1] = "";
+  uint32_t len = 0;
+  uint32_t new_len = 0;
+  bool ok = true;
+  while (ok && next_word(p, oldspeak, &len) &&
+         (!pairs || next_newspeak(p, newspeak, &new_len))) {
+    if (oldspeak[0] == '\0') { // Never looked up, so not worth a key
+      continue;
+    }
+    if (*n == *cap) {
+      *cap = *cap ? *cap * 2 : 1024;
+      Pair *grown = (Pair *)realloc(*list, sizeof(Pair) * *cap);
+      if (grown == NULL) {
+        ok = false;
+        break;
+      }
+      *list = grown;
+    }
+    Pair *pair = &(*list)[*n];
+    pair->len = len;
+    pair->oldspeak = arena_strdup(arena, oldspeak, pair->len);
+    pair->newspeak = pairs ? arena_strdup(arena, newspeak, new_len) : NULL;
+    pair->order = *n;
+    ok = pair->oldspeak != NULL && (!pairs || pair->newspeak != NULL);
+    *n += 1;
+  }
+  parser_delete(&p);
+  return ok;
+}
+
+// Builds the image of a Trie from the unique, sorted pairs and the sorted,
+// unique newspeak strings. Returns NULL if the memory couldn't be allocated.
+static Header *build(Builder *b, uint32_t n, char **values, uint32_t n_values) {
+  b->free_head = -1;
+  if (!grow(b, 1024)) {
+    return NULL;
+  }
+  b->cells[0].check = -1;
+  b->top = 1 + TRIE_CODES;
+  if (n == 0) {
+    b->cells[0].base = 1;
+  } else if (!place(b, 0, 0, n, 0)) {
+    return NULL;
+  }
+  // The newspeak strings are front-coded in blocks: the first string of a
+  // block is stored whole, and the others as the length of the prefix they
+  // share with the one before and the rest of their bytes
+  uint64_t n_blocks = (n_values + TRIE_BLOCK - 1) / TRIE_BLOCK;
+  uint64_t pool_size = 0;
+  for (uint32_t i = 0; i < n_values; i += 1) {
+    pool_size += 4 + strlen(values[i]);
+  }
+  uint64_t size = sizeof(Header) + sizeof(Cell) * b->top +
+                  sizeof(uint32_t) * n_blocks + pool_size;
+  Header *h = (Header *)malloc(size);
+  if (h == NULL) {
+    return NULL;
+  }
+  memcpy(h->magic, TRIE_MAGIC, sizeof(h->magic));
+  h->norm = normalizer.flags;
+  h->n_cells = b->top;
+  h->n_keys = n;
+  h->n_values = n_values;
+  h->n_blocks = n_blocks;
+  h->node_bytes = 0;
+  for (uint32_t i = 0; i < n; i += 1) {
+    Pair *p = &b->pairs[i];
+    h->node_bytes +=
+        dict_word_bytes(p->len, p->newspeak ? strlen(p->newspeak) : 0);
+  }
+  Cell *cells = (Cell *)(h + 1);
+  memcpy(cells, b->cells, sizeof(Cell) * b->top);
+  uint32_t *blocks = (uint32_t *)(cells + b->top);
+  uint8_t *pool = (uint8_t *)(blocks + n_blocks);
+  uint64_t at = 0;
+  for (uint32_t i = 0; i < n_values; i += 1) {
+    uint32_t len = strlen(values[i]);
+    if (i % TRIE_BLOCK == 0) {
+      blocks[i / TRIE_BLOCK] = at;
+      at = put16(pool, at, len);
+      memcpy(pool + at, values[i], len);
+      at += len;
+    } else {
+      uint32_t prefix = 0;
+      while (prefix < len && values[i][prefix] == values[i - 1][prefix]) {
+        prefix += 1;
+      }
+      at = put16(pool, at, prefix);
+      at = put16(pool, at, len - prefix);
+      memcpy(pool + at, values[i] + prefix, len - prefix);
+      at += len - prefix;
+    }
+  }
+  h->pool_size = at;
+  h->size = size - pool_size + at;
+  return h;
+}
+
+// Builds a Trie from the badspeak words and oldspeak-newspeak pairs of the
+// dictionary files, read like dict_load reads them. The trie maps every
+// oldspeak to the id of its newspeak; the distinct newspeak strings are
+// sorted and front-coded in a shared pool. Returns NULL if a file can't be
+// opened or the memory couldn't be allocated.
+Trie *trie_load(char *badspeak, char *newspeak) {
+  Arena *arena = arena_create(65536);
+  Pair *pairs = NULL;
+  uint32_t n = 0;
+  uint32_t cap = 0;
+  char **values = NULL;
+  Header *h = NULL;
+  Builder b;
+  memset(&b, 0, sizeof(b));
+  fill_codes(b.codes);
+  if (arena && read_pairs(badspeak, false, &pairs, &n, &cap, arena) &&
+      read_pairs(newspeak, true, &pairs, &n, &cap, arena)) {
+    // Keeps the first pair of each oldspeak, and drops the words with
+    // characters that next_word never returns
+    qsort(pairs, n, sizeof(Pair), compare_pairs);
+    uint32_t kept = 0;
+    for (uint32_t i = 0; i < n; i += 1) {
+      bool valid = true;
+      for (uint32_t j = 0; j < pairs[i].len; j += 1) {
+        valid = valid && b.codes[(uint8_t)pairs[i].oldspeak[j]] != 0;
+      }
+      if (valid && (kept == 0 ||
+                    strcmp(pairs[kept - 1].oldspeak, pairs[i].oldspeak) != 0)) {
+        pairs[kept] = pairs[i];
+        kept += 1;
+      }
+    }
+    n = kept;
+    // Numbers the distinct newspeak strings in sorted order
+    values = (char **)malloc(sizeof(char *) * (n + 1));
+    uint32_t n_values = 0;
+    for (uint32_t i = 0; values && i < n; i += 1) {
+      if (pairs[i].newspeak) {
+        values[n_values] = pairs[i].newspeak;
+        n_values += 1;
+      }
+    }
+    if (values) {
+      qsort(values, n_values, sizeof(char *), compare_strings);
+      uint32_t unique = 0;
+      for (uint32_t i = 0; i < n_values; i += 1) {
+        if (unique == 0 || strcmp(values[unique - 1], values[i]) != 0) {
+          values[unique] = values[i];
+          unique += 1;
+        }
+      }
+      n_values = unique;
+      for (uint32_t i = 0; i < n; i += 1) {
+        pairs[i].value = 0;
+        if (pairs[i].newspeak) {
+          char **v = (char **)bsearch(&pairs[i].newspeak, values, n_values,
+                                      sizeof(char *), compare_strings);
+          pairs[i].value = v - values + 1;
+        }
+      }
+      b.pairs = pairs;
+      h = build(&b, n, values, n_values);
+    }
+  }
+  free(b.cells);
+  free(b.next);
+  free(b.prev);
+  free(b.tries);
+  free(values);
+  free(pairs);
+  arena_delete(&arena);
+  if (h == NULL) {
+    return NULL;
+  }
+  Trie *t = (Trie *)malloc(sizeof(Trie));
+  if (t == NULL) {
+    free(h);
+    return NULL;
+  }
+  attach(t, h, true, false);
+  return t;
+}
+
+// Maps a Trie image written by trie_save. Nothing is read up front: the pages
+// are loaded as the lookups touch them, and can be shared by every process
+// that maps the same file. Returns NULL if the file can't be mapped or isn't
+// a Trie image.
+Trie *trie_open(char *path) {
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    return NULL;
+  }
+  Trie *t = trie_map(fd);
+  close(fd);
+  return t;
+}
+
+// Maps the Trie image in the open file fd (a file or a shared memory
+// object) read-only and shared, so every process that maps it uses the same
+// pages. fd can be closed afterwards. Returns NULL if it can't be mapped or
+// isn't a Trie image.
+Trie *trie_map(int fd) {
+  struct stat st;
+  void *map = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && (uint64_t)st.st_size >= sizeof(Header)) {
+    map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+  }
+  if (map == MAP_FAILED) {
+    return NULL;
+  }
+  Header *h = (Header *)map;
+  Trie *t = valid(h, st.st_size) ? (Trie *)malloc(sizeof(Trie)) : NULL;
+  if (t == NULL) {
+    munmap(map, st.st_size);
+    return NULL;
+  }
+  // The lookups jump around the cells, so reading ahead would be wasted
+  madvise(map, st.st_size, MADV_RANDOM);
+  attach(t, h, false, true);
+  return t;
+}
+
+// Uses a Trie image that is compiled into the program (see trie_write_c), so
+// nothing is read or built. Returns NULL if it isn't a Trie image.
+Trie *trie_static(const void *image, uint64_t size) {
+  Header *h = (Header *)image;
+  Trie *t = valid(h, size) ? (Trie *)malloc(sizeof(Trie)) : NULL;
+  if (t) {
+    attach(t, h, false, false);
+  }
+  return t;
+}
+
+// The destructor for a Trie. Frees (or unmaps) its image, unless it is
+// compiled into the program, frees the Trie and sets the pointer to NULL.
+void trie_delete(Trie **t) {
+  if (*t) {
+    if ((*t)->mapped) {
+      munmap((*t)->header, (*t)->header->size);
+    } else if ((*t)->owned) {
+      free((*t)->header);
+    }
+    free(*t);
+    *t = NULL;
+  }
+}
+
+// Writes the image of the Trie to path, so trie_open can map it later.
+// Returns false if it couldn't be written.
+bool trie_save(Trie *t, char *path) {
+  FILE *f = fopen(path, "wb");
+  if (f == NULL) {
+    return false;
+  }
+  bool ok = fwrite(t->header, 1, t->header->size, f) == t->header->size;
+  return fclose(f) == 0 && ok;
+}
+
+// Writes the image of the Trie as C source that defines it as the read-only
+// array name (and its size as name_size), aligned to a 64 byte cache line.
+// Compiled into the program and passed to trie_static, it is used where it
+// lies. Returns false if it couldn't be written.
+bool trie_write_c(Trie *t, char *path, char *name) {
+  FILE *f = fopen(path, "w");
+  if (f == NULL) {
+    return false;
+  }
+  uint8_t *image = (uint8_t *)t->header;
+  uint64_t size = t->header->size;
+  fprintf(f, "// Generated by banhammer --emit-static from the dictionary "
+             "files. Do not edit.\n");
+  fprintf(f, "#include <stdint.h>\n\n");
+  fprintf(f, "_Alignas(64) const unsigned char %s[%lu] = {", name, size);
+  for (uint64_t i = 0; i < size; i += 1) {
+    fprintf(f, "%s0x%02x,", i % 16 == 0 ? "\n    " : " ", image[i]);
+  }
+  fprintf(f, "\n};\n\nconst uint64_t %s_size = %lu;\n", name, size);
+  bool ok = !ferror(f);
+  return fclose(f) == 0 && ok;
+}
+
+// Looks up word, which has length len. Each character is one step down the
+// double array: an add and a compare on one 8-byte cell.
+// Returns -1 if word isn't in the Trie. Else, returns 0 for badspeak, or the
+// newspeak value to pass to trie_newspeak.
+int64_t trie_lookup(Trie *t, char *word, uint32_t len) {
+  Cell *cells = t->cells;
+  int32_t s = 0;
+  for (uint32_t i = 0; i < len; i += 1) {
+    uint8_t c = t->codes[(uint8_t)word[i]];
+    int32_t u = cells[s].base + c;
+    if (c == 0 || cells[u].check != s) {
+      return -1;
+    }
+    s = u;
+  }
+  int32_t end = cells[s].base;
+  if (cells[end].check != s) {
+    return -1;
+  }
+  return -(int64_t)cells[end].base - 1;
+}
+
+// Decodes the newspeak of a value returned by trie_lookup into buf, which
+// must hold MAX_PARSER_LINE_LENGTH + 1 bytes. Returns buf, or NULL if the
+// value is 0 (badspeak).
+char *trie_newspeak(Trie *t, uint32_t value, char *buf) {
+  if (value == 0) {
+    return NULL;
+  }
+  uint32_t id = value - 1;
+  uint8_t *p = t->pool + t->blocks[id / TRIE_BLOCK];
+  uint32_t len = get16(p);
+  memcpy(buf, p + 2, len);
+  p += 2 + len;
+  for (uint32_t i = 0; i < id % TRIE_BLOCK; i += 1) {
+    uint32_t prefix = get16(p);
+    uint32_t suffix = get16(p + 2);
+    memcpy(buf + prefix, p + 4, suffix);
+    p += 4 + suffix;
+    len = prefix + suffix;
+  }
+  buf[len] = '\0';
+  return buf;
+}
+
+// Returns the image of the Trie, which holds no pointers, so it can be copied
+// anywhere (trie_size bytes) and used from there
+const void *trie_image(Trie *t) { return t->header; }
+
+// Returns the number of words in the Trie
+uint64_t trie_keys(Trie *t) { return t->header->n_keys; }
+
+// Returns the number of cells of the double array
+uint64_t trie_cells(Trie *t) { return t->header->n_cells; }
+
+// Returns the size in bytes of the image of the Trie
+uint64_t trie_size(Trie *t) { return t->header->size; }
+
+// Returns the number of bytes Nodes for every word of the Trie take in an
+// arena, which is what the offense lists reserve
+uint64_t trie_node_bytes(Trie *t) { return t->header->node_bytes; }
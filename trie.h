@@ -0,0 +1,43 @@
+#ifndef __TRIE_H__
+#define __TRIE_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Codes of the bytes a word can hold (' - 0-9 a-z and the bytes of multibyte
+// UTF-8 characters); code 0 ends a word
+#define TRIE_CODES 167
+// Number of newspeak strings front-coded together in the string pool
+#define TRIE_BLOCK 16
+
+typedef struct Trie Trie;
+
+Trie *trie_load(char *badspeak, char *newspeak);
+
+Trie *trie_open(char *path);
+
+Trie *trie_map(int fd);
+
+Trie *trie_static(const void *image, uint64_t size);
+
+void trie_delete(Trie **t);
+
+bool trie_save(Trie *t, char *path);
+
+bool trie_write_c(Trie *t, char *path, char *name);
+
+int64_t trie_lookup(Trie *t, char *word, uint32_t len);
+
+char *trie_newspeak(Trie *t, uint32_t value, char *buf);
+
+const void *trie_image(Trie *t);
+
+uint64_t trie_keys(Trie *t);
+
+uint64_t trie_cells(Trie *t);
+
+uint64_t trie_size(Trie *t);
+
+uint64_t trie_node_bytes(Trie *t);
+
+#endif
@@ -0,0 +1,128 @@
+#include "utf8.h"
+#include "utf8tab.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Returns the class of the code point cp from the tables of utf8tab.h: 0 if
+// it can't be in a word, else 1 + the index of its case fold delta
+static inline uint8_t class_of(uint32_t cp) {
+  uint32_t mid = utf8_index[cp >> 8];
+  uint32_t leaf = utf8_mids[32 * mid + ((cp >> 3) & 31)];
+  return utf8_leaves[8 * leaf + (cp & 7)];
+}
+
+// Decodes the UTF-8 sequence at the start of s into cp. Returns its length,
+// or 0 if s doesn't start with a valid sequence (a stray continuation byte,
+// a sequence cut short, an overlong encoding, a surrogate or a code point past
+// U+10FFFF). s must be terminated by a '\0', which ends any sequence.
+uint32_t utf8_decode(const char *s, uint32_t *cp) {
+  const uint8_t *b = (const uint8_t *)s;
+  if (b[0] < 0x80) {
+    *cp = b[0];
+    return 1;
+  }
+  uint32_t len;
+  uint32_t c;
+  uint32_t min;
+  if ((b[0] & 0xe0) == 0xc0) {
+    len = 2;
+    c = b[0] & 0x1f;
+    min = 0x80;
+  } else if ((b[0] & 0xf0) == 0xe0) {
+    len = 3;
+    c = b[0] & 0x0f;
+    min = 0x800;
+  } else if ((b[0] & 0xf8) == 0xf0) {
+    len = 4;
+    c = b[0] & 0x07;
+    min = 0x10000;
+  } else {
+    return 0;
+  }
+  for (uint32_t i = 1; i < len; i += 1) {
+    if ((b[i] & 0xc0) != 0x80) {
+      return 0;
+    }
+    c = (c << 6) | (b[i] & 0x3f);
+  }
+  if (c < min || c > 0x10ffff || (c >= 0xd800 && c <= 0xdfff)) {
+    return 0;
+  }
+  *cp = c;
+  return len;
+}
+
+// Writes the UTF-8 sequence of cp to s (which isn't terminated). Returns its
+// length.
+uint32_t utf8_encode(uint32_t cp, char *s) {
+  uint8_t *b = (uint8_t *)s;
+  if (cp < 0x80) {
+    b[0] = cp;
+    return 1;
+  }
+  if (cp < 0x800) {
+    b[0] = 0xc0 | (cp >> 6);
+    b[1] = 0x80 | (cp & 0x3f);
+    return 2;
+  }
+  if (cp < 0x10000) {
+    b[0] = 0xe0 | (cp >> 12);
+    b[1] = 0x80 | ((cp >> 6) & 0x3f);
+    b[2] = 0x80 | (cp & 0x3f);
+    return 3;
+  }
+  b[0] = 0xf0 | (cp >> 18);
+  b[1] = 0x80 | ((cp >> 12) & 0x3f);
+  b[2] = 0x80 | ((cp >> 6) & 0x3f);
+  b[3] = 0x80 | (cp & 0x3f);
+  return 4;
+}
+
+// Returns true if the code point cp can be part of a word: a letter, mark or
+// number of any script, or ' and -
+bool utf8_word(uint32_t cp) {
+  return cp == '\'' || cp == '-' || (cp <= 0x10ffff && class_of(cp) != 0);
+}
+
+// Returns the simple case folding of the code point cp (cp itself if it has
+// none)
+uint32_t utf8_fold(uint32_t cp) {
+  uint8_t c = cp <= 0x10ffff ? class_of(cp) : 0;
+  return c == 0 ? cp : (uint32_t)((int32_t)cp + utf8_deltas[c - 1]);
+}
+
+// Returns how the code point cp is normalized: the code point it becomes in
+// the low 24 bits (0 if it is removed) and the NORM_ kind of normalization in
+// the high 8 bits, or 0 if it isn't normalized. See utf8tab.h.
+uint32_t utf8_norm(uint32_t cp) {
+  if (cp > 0x10ffff) {
+    return 0;
+  }
+  uint32_t mid = utf8_norm_index[cp >> 9];
+  uint32_t leaf = utf8_norm_mids[32 * mid + ((cp >> 4) & 31)];
+  return utf8_norms[utf8_norm_leaves[16 * leaf + (cp & 15)]];
+}
+
+// Copies the character at the start of s to word, case folded, if it can be
+// part of a word and its folding fits in room bytes. This is the slow path of
+// the tokenizer, for the multibyte characters the word_span kernel stops at.
+// Returns the number of bytes of s it took (0 if it wasn't copied), and sets
+// n to the number of bytes written to word.
+uint32_t utf8_word_fold(const char *s, char *word, uint32_t room,
+                        uint32_t *n) {
+  uint32_t cp = 0;
+  uint32_t len = utf8_decode(s, &cp);
+  if (len == 0 || !utf8_word(cp)) {
+    return 0;
+  }
+  char out[UTF8_MAX];
+  uint32_t k = utf8_encode(utf8_fold(cp), out);
+  if (k > room) {
+    return 0;
+  }
+  for (uint32_t i = 0; i < k; i += 1) {
+    word[i] = out[i];
+  }
+  *n = k;
+  return len;
+}
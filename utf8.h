@@ -0,0 +1,23 @@
+#ifndef __UTF8_H__
+#define __UTF8_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Longest UTF-8 sequence of a code point, in bytes
+#define UTF8_MAX 4
+
+uint32_t utf8_decode(const char *s, uint32_t *cp);
+
+uint32_t utf8_encode(uint32_t cp, char *s);
+
+bool utf8_word(uint32_t cp);
+
+uint32_t utf8_fold(uint32_t cp);
+
+uint32_t utf8_norm(uint32_t cp);
+
+uint32_t utf8_word_fold(const char *s, char *word, uint32_t room,
+                        uint32_t *n);
+
+#endif
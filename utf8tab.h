@@ -0,0 +1,1171 @@
+#ifndef __UTF8TAB_H__
+#define __UTF8TAB_H__
+
+#include <stdint.h>
+
+// Generated by utf8tab.py ('make utf8tab') from the Unicode
+// 14.0.0 character database. Do not edit.
+// The class of a code point c is
+//   utf8_leaves[8 * utf8_mids[32 * utf8_index[c >> 8] + ((c >> 3) & 31)] +
+//               (c & 7)]
+// which is 0 if c can't be part of a word, or else 1 + the index in
+// utf8_deltas of what to add to c to case fold it. Word characters are the
+// letters, marks and numbers (general categories L*, M* and N*). The folding
+// is the simple case folding (one code point to one code point), or the lower
+// case mapping where that has none.
+#define UTF8_BLOCKS 4352
+
+static const uint8_t utf8_index[4352] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20,
+    17, 21, 22, 23, 24, 25, 26, 27, 17, 28, 29, 30, 31, 32, 32, 33, 32, 32, 34,
+    32, 32, 32, 32, 35, 36, 37, 32, 38, 39, 40, 32, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 41,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 42, 17, 43, 44, 45, 46, 47, 48, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 49, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    17, 50, 51, 17, 52, 53, 54, 55, 56, 57, 58, 59, 60, 17, 61, 62, 63, 64, 65,
+    66, 67, 68, 69, 70, 71, 72, 73, 74, 75, 76, 77, 78, 79, 80, 32, 81, 82, 83,
+    84, 17, 17, 17, 85, 86, 87, 32, 32, 32, 32, 32, 32, 32, 32, 32, 88, 17, 17,
+    17, 17, 89, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 17,
+    17, 90, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 17, 17, 91,
+    92, 32, 32, 93, 94, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 95, 17, 17, 17, 17, 96, 97, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 98, 17, 99, 100, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 101, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 102, 32, 103, 104, 105, 106, 107, 108, 109, 32, 32, 110,
+    32, 32, 32, 32, 111, 112, 113, 114, 32, 32, 32, 32, 115, 116, 117, 32, 32,
+    118, 119, 120, 32, 32, 121, 32, 32, 32, 32, 32, 32, 32, 32, 32, 122, 32, 32,
+    32, 32, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 123, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 124, 125, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    126, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 127, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 17, 17, 128, 32, 32, 32, 32, 32, 17, 17, 17, 17, 17, 17, 17,
+    17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 17, 129, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 130, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32, 32,
+    32, 32, 32, 32, 32,
+};
+
+static const uint8_t utf8_mids[4192] = {
+    0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 4, 5, 6, 1, 1, 7, 0, 0, 0, 0, 0, 8, 9, 10, 4,
+    4, 11, 12, 1, 1, 13, 1, 14, 14, 14, 14, 14, 14, 15, 16, 16, 15, 14, 14, 14,
+    14, 14, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 16, 28, 14, 14, 29, 14,
+    14, 14, 14, 14, 30, 14, 31, 32, 33, 14, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 34, 1, 2, 0, 35, 36, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 37, 1, 1, 1, 1, 1,
+    38, 39, 40, 41, 42, 4, 43, 44, 1, 1, 45, 46, 47, 14, 14, 14, 48, 49, 50, 50,
+    4, 4, 4, 4, 1, 1, 1, 1, 1, 1, 14, 14, 14, 14, 51, 15, 14, 14, 14, 14, 14,
+    14, 52, 53, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 54, 55, 55, 55,
+    56, 57, 1, 1, 1, 1, 1, 58, 6, 1, 1, 1, 1, 59, 60, 0, 1, 1, 1, 61, 7, 0, 0,
+    0, 1, 7, 1, 1, 1, 1, 1, 1, 1, 1, 1, 34, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    62, 63, 1, 64, 1, 63, 0, 0, 1, 1, 1, 1, 1, 1, 1, 65, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 2, 0, 1, 1, 1, 1, 1, 1, 66, 67, 1, 1, 1, 1, 1, 66, 0, 0, 1, 1,
+    1, 68, 1, 7, 1, 1, 1, 69, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 70, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 71, 1, 6, 1, 62, 63, 72, 1, 1, 64, 73, 74, 63,
+    75, 76, 77, 71, 1, 74, 78, 79, 61, 72, 1, 1, 64, 80, 81, 61, 82, 57, 83, 84,
+    1, 66, 0, 79, 59, 70, 1, 1, 64, 85, 74, 59, 86, 58, 0, 71, 1, 0, 6, 79, 63,
+    72, 1, 1, 64, 85, 74, 63, 82, 87, 77, 71, 1, 6, 0, 88, 89, 90, 91, 92, 89,
+    1, 34, 89, 90, 93, 0, 84, 1, 7, 0, 1, 94, 64, 1, 1, 64, 1, 74, 94, 90, 95,
+    96, 71, 1, 0, 13, 62, 94, 64, 1, 1, 64, 62, 74, 94, 90, 95, 95, 71, 1, 97,
+    0, 1, 94, 64, 1, 1, 1, 1, 1, 94, 98, 99, 1, 71, 1, 1, 64, 79, 1, 13, 100, 1,
+    1, 70, 101, 13, 102, 103, 1, 84, 1, 104, 0, 6, 1, 1, 1, 1, 1, 1, 7, 1, 13,
+    1, 2, 0, 0, 0, 0, 91, 105, 1, 1, 106, 1, 1, 66, 103, 66, 1, 74, 0, 0, 0, 0,
+    58, 0, 0, 2, 1, 1, 106, 107, 1, 6, 1, 1, 1, 35, 6, 1, 94, 1, 1, 6, 1, 1, 1,
+    35, 108, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 66, 109, 109, 109, 109, 110, 111, 1, 1, 1, 1, 1, 105, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 90, 13, 90, 1, 1, 1, 1, 1, 90, 1, 1,
+    1, 1, 90, 13, 90, 1, 13, 1, 1, 1, 1, 1, 1, 1, 90, 1, 1, 1, 1, 1, 1, 1, 1,
+    65, 0, 6, 1, 35, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 66, 112, 6, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 63, 1, 1, 6, 1, 1, 7, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 89, 1, 58, 1, 1, 66, 76, 1, 1, 35, 0, 1, 1, 68, 0,
+    1, 94, 113, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 114, 115, 1, 2, 1, 2, 0, 116,
+    1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 58, 1, 1, 1, 1, 1, 7, 1, 1, 1, 1, 1,
+    1, 1, 1, 66, 0, 1, 1, 1, 13, 1, 68, 1, 68, 84, 1, 1, 1, 1, 66, 35, 0, 1, 1,
+    1, 1, 1, 68, 1, 1, 1, 2, 1, 7, 0, 0, 0, 0, 1, 1, 1, 68, 1, 1, 1, 1, 1, 1, 1,
+    13, 1, 1, 1, 63, 1, 2, 1, 2, 76, 0, 1, 1, 1, 13, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 35, 1, 2, 0, 117, 68, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 68, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 118, 1, 1, 1, 1, 1, 66, 119, 120,
+    121, 121, 121, 121, 121, 122, 0, 0, 105, 1, 1, 1, 1, 7, 14, 14, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 123, 124, 14, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 1, 125, 66, 112, 1, 125, 1, 125, 66,
+    112, 1, 126, 1, 125, 1, 66, 1, 125, 1, 125, 1, 125, 94, 127, 128, 129, 71,
+    130, 1, 131, 128, 132, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 133, 1,
+    2, 1, 35, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 58, 0, 102, 100, 101, 134, 135, 136,
+    137, 74, 87, 138, 1, 1, 139, 139, 1, 1, 140, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 1, 1, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 100, 1, 1, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 84, 1, 1, 1, 68, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 55, 55, 55, 55, 55, 55, 1, 1, 1, 1, 1, 1, 141, 142, 143, 144, 14, 14,
+    14, 14, 14, 14, 14, 14, 14, 14, 14, 14, 145, 146, 147, 148, 1, 1, 1, 1, 59,
+    148, 1, 1, 1, 1, 1, 1, 1, 76, 0, 76, 1, 1, 13, 0, 13, 13, 13, 13, 13, 13,
+    13, 13, 1, 1, 1, 1, 0, 0, 0, 0, 0, 76, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 87, 0, 0, 0, 6, 1, 134, 35, 6, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 13, 149, 6, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 105, 87,
+    1, 1, 1, 1, 1, 6, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 13, 150, 0, 1, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 2, 0, 0, 0, 1, 6, 1, 0, 0, 0, 0, 1, 2,
+    0, 0, 0, 0, 6, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 35, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 66, 1, 35, 1, 1, 1, 68, 0, 0, 14, 14, 14, 14, 14, 123, 105, 59, 14,
+    14, 14, 31, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 0, 0, 0, 76, 1, 151, 14, 15,
+    14, 14, 14, 14, 14, 14, 14, 1, 152, 14, 153, 154, 14, 14, 155, 156, 14, 157,
+    158, 159, 160, 0, 0, 161, 1, 1, 1, 1, 1, 1, 162, 66, 0, 1, 1, 1, 1, 1, 1,
+    68, 0, 1, 1, 1, 1, 1, 1, 1, 1, 66, 0, 1, 2, 1, 1, 1, 163, 1, 1, 1, 1, 1, 66,
+    1, 1, 1, 1, 68, 0, 1, 1, 1, 35, 1, 1, 1, 1, 1, 1, 1, 1, 58, 76, 1, 2, 1, 1,
+    1, 13, 1, 1, 1, 1, 1, 1, 13, 0, 1, 66, 1, 2, 1, 1, 13, 100, 1, 1, 1, 1, 1,
+    1, 1, 1, 7, 0, 0, 164, 1, 1, 165, 0, 69, 69, 69, 0, 13, 13, 1, 1, 1, 1, 1,
+    105, 1, 2, 166, 166, 166, 166, 166, 166, 166, 166, 166, 166, 1, 1, 1, 1, 1,
+    167, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 68,
+    0, 1, 1, 13, 117, 1, 1, 1, 1, 1, 68, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    66, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 0, 0, 0, 0, 13, 0, 117, 87, 1,
+    64, 13, 103, 168, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 0, 0, 0, 117, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 66, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 100, 1,
+    1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 68, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 94, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 35, 0, 0, 1, 2, 3, 4,
+    4, 5, 6, 1, 1, 7, 84, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 13, 100, 100, 100, 169,
+    0, 0, 0, 0, 1, 62, 1, 1, 13, 1, 1, 170, 1, 66, 1, 66, 0, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 7, 76, 1, 1, 1, 1, 1, 68, 0, 1, 1, 1, 1,
+    1, 1, 1, 58, 0, 104, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 148, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 35, 1, 1, 1, 1, 1, 1, 58, 0, 1,
+    1, 1, 68, 1, 1, 1, 1, 68, 87, 1, 1, 1, 7, 1, 1, 1, 1, 1, 7, 1, 1, 1, 66, 1,
+    1, 1, 1, 68, 1, 134, 0, 0, 0, 0, 0, 171, 171, 171, 171, 171, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 66, 1, 2, 171, 171, 171, 171, 172, 1, 1, 1, 1,
+    68, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 68, 0, 173, 174, 173, 174, 175, 1,
+    70, 1, 70, 176, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 13, 0, 1, 1, 66,
+    0, 1, 0, 0, 0, 59, 1, 1, 1, 1, 1, 64, 7, 0, 0, 0, 0, 0, 0, 0, 0, 66, 64, 1,
+    1, 1, 1, 59, 177, 1, 1, 66, 1, 1, 1, 13, 6, 1, 1, 1, 13, 76, 1, 0, 0, 0, 0,
+    0, 0, 1, 1, 167, 117, 1, 1, 1, 68, 1, 1, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 1, 99, 1, 1, 100, 1, 1, 1, 1, 1, 178, 99, 62, 6, 1, 1, 66, 61,
+    1, 58, 0, 0, 1, 1, 1, 13, 1, 1, 1, 1, 0, 0, 0, 0, 1, 6, 1, 1, 13, 117, 0, 0,
+    1, 1, 1, 1, 1, 1, 66, 0, 1, 1, 66, 1, 1, 1, 7, 1, 1, 1, 2, 0, 0, 6, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 58, 0, 0, 0, 0, 0, 0, 179,
+    179, 179, 179, 179, 179, 180, 0, 1, 1, 1, 1, 1, 1, 7, 100, 1, 1, 1, 1, 1, 0,
+    1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 13, 1, 1, 1, 1, 1, 176, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 35, 0, 0, 0, 1, 1,
+    66, 0, 0, 0, 0, 0, 1, 1, 1, 68, 0, 0, 1, 1, 13, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    13, 0, 100, 1, 1, 1, 66, 76, 1, 1, 1, 1, 1, 1, 1, 7, 8, 0, 1, 1, 1, 58, 1,
+    2, 1, 1, 1, 1, 1, 1, 94, 1, 99, 0, 1, 1, 1, 1, 181, 0, 1, 1, 1, 1, 1, 1, 1,
+    1, 35, 182, 1, 183, 6, 1, 35, 0, 1, 1, 70, 1, 1, 1, 1, 108, 0, 0, 0, 0, 0,
+    0, 0, 0, 13, 184, 1, 59, 1, 58, 1, 1, 1, 1, 1, 1, 1, 7, 1, 2, 62, 63, 72, 1,
+    1, 64, 85, 70, 63, 82, 93, 87, 71, 35, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 7, 1, 34, 2, 0, 0, 0, 1, 1, 1,
+    1, 1, 1, 1, 1, 59, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 66, 1, 58, 0, 0, 66, 0, 0, 0, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 185, 0, 1, 2, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 58, 1, 2, 0, 0,
+    0, 0, 0, 0, 1, 1, 1, 65, 1, 68, 1, 68, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 7, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 1, 1, 1, 1, 1, 1, 7, 76, 13, 186, 178, 1,
+    1, 1, 59, 72, 68, 0, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 1, 100, 1, 1, 1, 1, 1,
+    100, 176, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 13, 76, 0, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 187, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 58, 1, 64, 1, 1, 1, 1, 13, 1, 58,
+    0, 1, 1, 1, 35, 100, 1, 1, 1, 100, 1, 1, 6, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    13, 70, 1, 1, 1, 1, 13, 188, 1, 0, 1, 2, 59, 64, 1, 1, 1, 13, 70, 58, 1, 2,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 58, 0, 1, 1, 35, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 13, 0, 0, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 68, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    58, 0, 1, 1, 1, 1, 1, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 13, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 58, 1,
+    1, 1, 13, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 13, 1, 2, 1, 1, 1, 66, 35, 0, 1,
+    1, 1, 1, 1, 1, 13, 0, 68, 0, 1, 70, 70, 1, 1, 87, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 4, 4, 4, 1, 1, 1, 1, 1, 1,
+    13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 61, 1,
+    1, 1, 1, 1, 1, 1, 76, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 176, 0, 2, 0, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 66, 0, 0, 0, 0, 0, 1, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62,
+    178, 1, 1, 1, 1, 7, 0, 0, 0, 0, 0, 7, 0, 99, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 68, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 7, 1, 35, 1, 58, 1, 189, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 66, 1, 1, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 87, 118, 7, 117, 65,
+    68, 0, 0, 0, 150, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 169,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 68, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 58, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 94, 1, 1, 1, 1, 1, 1, 1, 1, 94,
+    190, 182, 1, 191, 62, 1, 1, 1, 1, 1, 1, 1, 59, 65, 94, 94, 1, 1, 1, 192,
+    103, 100, 64, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 66, 1, 1, 1, 64,
+    1, 1, 105, 1, 1, 1, 105, 1, 1, 94, 1, 1, 1, 94, 1, 1, 13, 1, 1, 1, 13, 1, 1,
+    1, 64, 1, 1, 1, 64, 1, 1, 105, 71, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 13,
+    117, 1, 1, 1, 1, 1, 35, 148, 0, 162, 0, 0, 117, 6, 1, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 1, 1, 13, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 1, 1, 72, 168, 7, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 35, 1,
+    66, 1, 138, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 13, 0, 0,
+    1, 1, 1, 1, 1, 1, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 178, 1, 13, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 63, 1, 13, 0, 0, 0, 0, 0, 193,
+    193, 193, 193, 194, 1, 1, 1, 1, 68, 1, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 1,
+    1, 1, 1, 1, 1, 62, 195, 0, 0, 0, 0, 0, 0, 0, 0, 0, 6, 1, 1, 1, 1, 59, 1, 66,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62,
+    1, 1, 1, 196, 6, 105, 197, 102, 198, 196, 199, 196, 105, 105, 83, 1, 70, 1,
+    68, 79, 70, 1, 68, 0, 0, 0, 0, 0, 0, 0, 0, 1, 35, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 58, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 66, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 0, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 58, 0, 0, 0, 1, 1, 1, 66, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 7, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 0, 0,
+};
+
+static const uint8_t utf8_leaves[1600] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1,
+    1, 0, 3, 0, 0, 0, 1, 1, 0, 1, 1, 1, 0, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2, 2, 2,
+    2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 0, 4, 1, 4, 1, 4, 1, 4, 1, 1, 1, 4, 1, 4,
+    1, 4, 1, 1, 4, 1, 4, 1, 4, 1, 4, 5, 4, 1, 4, 1, 4, 1, 6, 1, 7, 4, 1, 4, 1,
+    8, 4, 1, 9, 9, 4, 1, 1, 10, 11, 12, 4, 1, 9, 13, 1, 14, 15, 4, 1, 1, 1, 14,
+    16, 1, 17, 4, 1, 4, 1, 4, 1, 18, 4, 1, 18, 1, 1, 4, 1, 18, 4, 1, 19, 19, 4,
+    1, 4, 1, 20, 4, 1, 1, 1, 4, 1, 1, 1, 1, 1, 1, 1, 21, 4, 1, 21, 4, 1, 21, 4,
+    1, 4, 1, 4, 1, 4, 1, 4, 1, 1, 4, 1, 1, 21, 4, 1, 4, 1, 22, 23, 24, 1, 4, 1,
+    4, 1, 4, 1, 4, 1, 4, 1, 1, 1, 1, 1, 1, 1, 25, 4, 1, 26, 27, 1, 1, 4, 1, 28,
+    29, 30, 4, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1,
+    0, 1, 0, 1, 1, 1, 1, 1, 31, 1, 1, 4, 1, 4, 1, 1, 0, 4, 1, 0, 0, 1, 1, 1, 1,
+    0, 31, 0, 0, 0, 0, 0, 0, 32, 0, 33, 33, 33, 0, 34, 0, 35, 35, 1, 2, 2, 2, 2,
+    2, 2, 2, 2, 2, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 4, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 36, 37, 38, 1, 1, 1, 39, 40, 1, 41, 42, 1, 1, 43,
+    44, 0, 4, 1, 45, 4, 1, 1, 24, 24, 24, 46, 46, 46, 46, 46, 46, 46, 46, 4, 1,
+    0, 1, 1, 1, 1, 1, 47, 4, 1, 4, 1, 4, 1, 4, 1, 4, 1, 4, 1, 4, 1, 1, 0, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48,
+    48, 48, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+    0, 1, 0, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, 0, 0, 1, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 0,
+    1, 1, 1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 0,
+    0, 1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, 1, 1, 0, 0,
+    1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 1, 1, 1, 0, 0,
+    1, 0, 1, 0, 0, 1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 0, 1, 1, 0, 1, 1, 0, 0, 1,
+    0, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0,
+    1, 1, 1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 0, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0,
+    0, 1, 1, 0, 1, 0, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 1, 1, 0, 0, 0, 0, 0, 1, 1, 0, 1, 1, 1, 0, 0, 1, 0, 0, 0, 1,
+    1, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1,
+    1, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    1, 0, 1, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 49, 49, 49, 49, 49,
+    49, 49, 49, 49, 49, 49, 49, 49, 49, 0, 49, 0, 0, 0, 0, 0, 49, 0, 0, 50, 50,
+    50, 50, 50, 50, 0, 0, 1, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 1, 0, 0,
+    0, 0, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0,
+    0, 0, 1, 1, 1, 51, 52, 53, 54, 54, 55, 56, 57, 58, 0, 0, 0, 0, 0, 0, 0, 59,
+    59, 59, 59, 59, 59, 59, 59, 59, 59, 59, 0, 0, 59, 59, 59, 4, 1, 4, 1, 4, 1,
+    1, 1, 1, 1, 1, 60, 1, 1, 61, 1, 50, 50, 50, 50, 50, 50, 50, 50, 0, 50, 0,
+    50, 0, 50, 0, 50, 50, 50, 62, 62, 63, 0, 64, 0, 0, 0, 1, 1, 1, 0, 1, 1, 65,
+    65, 65, 65, 63, 0, 0, 0, 50, 50, 66, 66, 0, 0, 0, 0, 50, 50, 67, 67, 45, 0,
+    0, 0, 68, 68, 69, 69, 63, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 1, 1,
+    0, 0, 0, 0, 0, 0, 1, 0, 70, 0, 1, 0, 71, 72, 1, 1, 0, 1, 1, 1, 73, 1, 1, 1,
+    1, 1, 1, 1, 0, 0, 0, 0, 1, 0, 74, 74, 74, 74, 74, 74, 74, 74, 1, 1, 1, 4, 1,
+    1, 1, 1, 4, 1, 75, 76, 77, 1, 1, 4, 1, 4, 1, 4, 1, 78, 79, 80, 81, 1, 4, 1,
+    1, 4, 1, 1, 1, 1, 1, 1, 1, 1, 82, 82, 4, 1, 4, 1, 1, 0, 0, 0, 0, 0, 0, 4, 1,
+    4, 1, 1, 1, 1, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 0, 0, 1,
+    1, 1, 0, 0, 1, 1, 1, 1, 0, 0, 0, 0, 4, 1, 4, 1, 4, 1, 1, 4, 1, 4, 1, 83, 4,
+    1, 1, 0, 0, 4, 1, 84, 1, 1, 4, 1, 4, 1, 1, 1, 4, 1, 4, 1, 85, 86, 87, 88,
+    85, 1, 89, 90, 91, 92, 4, 1, 4, 1, 4, 1, 4, 1, 42, 93, 94, 4, 1, 4, 1, 0, 0,
+    0, 0, 0, 4, 1, 0, 1, 0, 1, 4, 1, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 4,
+    1, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 1, 0,
+    0, 0, 0, 1, 1, 1, 1, 1, 0, 95, 95, 95, 95, 95, 95, 95, 95, 1, 1, 1, 0, 1, 1,
+    0, 0, 1, 1, 0, 1, 1, 0, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 1, 0, 1, 1, 0,
+    1, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 96, 0, 0, 0, 0, 97, 97, 97,
+    97, 97, 97, 97, 97, 97, 97, 97, 0, 97, 97, 97, 97, 97, 97, 97, 0, 97, 97, 0,
+    1, 1, 1, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 1, 1, 1, 1, 1, 0, 1, 1, 0,
+    34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 34, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0,
+    1, 0, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 1, 0, 0, 0, 1, 0, 1, 1, 1, 1, 0,
+    1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 0, 0,
+    0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 1, 1, 0, 1,
+    1, 0, 1, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 98, 98, 98, 98, 98, 98, 98, 98,
+    98, 98, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 0, 1, 0, 0, 1, 0,
+    1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 1, 1, 0, 1, 0, 1, 0, 1, 0, 1,
+};
+
+static const int32_t utf8_deltas[98] = {
+    0, 32, 775, 1, -121, -268, 210, 206, 205, 79, 202, 203, 207, 211, 209, 213,
+    214, 218, 217, 219, 2, -97, -56, -130, 10795, -163, 10792, -195, 69, 71,
+    116, 38, 37, 64, 63, 8, -30, -25, -15, -22, -54, -48, -60, -64, -7, 80, 15,
+    48, 7264, -8, -6222, -6221, -6212, -6210, -6211, -6204, -6180, 35267, -3008,
+    -58, -7615, -74, -9, -7173, -86, -100, -112, -128, -126, -7517, -8383,
+    -8262, 28, 16, -10743, -3814, -10727, -10780, -10749, -10783, -10782,
+    -10815, -35332, -42280, -42308, -42319, -42315, -42305, -42258, -42282,
+    -42261, 928, -42307, -35384, -38864, 40, 39, 34,
+};
+
+// The normalization of a code point c is found like its class, in blocks of
+// 16 code points:
+//   utf8_norms[utf8_norm_leaves[16 * utf8_norm_mids[32 * m + ((c >> 4) & 31)] +
+//                               (c & 15)]]
+// where m = utf8_norm_index[c >> 9]. The low 24 bits of an entry of utf8_norms
+// are the code point c becomes (case folded), or 0 if it is removed, and the
+// high 8 bits are the kind of normalization (a NORM_ flag of norm.h); 0 means
+// c isn't normalized. Only one kind applies to a code point, in this order:
+// - ignorables: the Default_Ignorable_Code_Point characters (zero width
+//   spaces and joiners, soft hyphens, variation selectors...), removed.
+// - diacritics: the combining diacritical marks, removed, and the letters
+//   whose canonical decomposition is a letter and such marks (or that are a
+//   letter with a stroke, like ł or ø), which become that letter.
+// - confusables: the letters and numbers with a compatibility decomposition
+//   to one letter or number (fullwidth and mathematical letters,
+//   superscripts...), and the Cyrillic and Greek letters that look like a
+//   Latin letter, which become that Latin letter.
+// The result may be normalized again (ё becomes е, which becomes e).
+#define UTF8_NORM_BLOCKS 2176
+
+static const uint8_t utf8_norm_index[2176] = {
+    0, 1, 2, 3, 4, 4, 4, 4, 5, 4, 4, 6, 7, 8, 9, 10, 11, 4, 12, 4, 4, 4, 13, 4,
+    14, 15, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 16, 4, 17, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    18, 19, 4, 20, 4, 4, 4, 21, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 22,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 23, 4, 24, 25, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    26, 4, 4, 4, 4, 4, 27, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 28, 29, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 30, 30, 30, 30,
+    30, 30, 30, 30, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4,
+};
+
+static const uint16_t utf8_norm_mids[992] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3, 4, 3, 5, 6, 7, 8, 9, 10, 11, 12, 13,
+    14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 0, 0, 0, 0, 29,
+    0, 0, 30, 0, 31, 31, 31, 31, 32, 31, 31, 33, 34, 35, 36, 37, 38, 39, 0, 40,
+    41, 42, 43, 44, 45, 41, 0, 46, 0, 0, 47, 48, 49, 50, 51, 52, 53, 54, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 55, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 56, 0, 0, 0, 0, 0, 57, 58,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 59, 0, 0, 0, 0, 60, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 61, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 62, 63,
+    64, 65, 66, 67, 0, 68, 69, 70, 31, 31, 31, 31, 71, 72, 73, 74, 75, 76, 77,
+    78, 79, 80, 81, 82, 83, 84, 85, 86, 87, 88, 89, 90, 91, 92, 93, 94, 87, 89,
+    93, 95, 96, 97, 98, 99, 60, 0, 100, 0, 0, 0, 101, 102, 103, 104, 0, 0, 0,
+    31, 31, 105, 106, 107, 108, 109, 110, 0, 111, 111, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 112, 0, 0, 0, 0, 0, 0, 0, 113, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 114, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 115, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 116, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 117, 118, 119, 120, 121, 122, 123, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 124, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 125, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 126, 0, 0, 0, 0, 0, 0, 0, 127, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 128, 129, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 130, 131, 132, 133, 134,
+    135, 136, 137, 138, 139, 140, 141, 142, 143, 144, 145, 146, 147, 148, 149,
+    150, 151, 152, 153, 154, 155, 156, 157, 158, 159, 0, 0, 0, 0, 160, 0, 0,
+    161, 162, 163, 164, 165, 166, 167, 0, 168, 169, 170, 101, 0, 31, 0, 0, 0, 0,
+    0, 171, 172, 173, 174, 175, 176, 177, 178, 0, 103, 179, 180, 179, 180, 181,
+    182, 183, 184, 185, 186, 187, 188, 0, 189, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 190, 191, 192, 193, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 194, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 195, 0, 0, 0, 0, 0, 0, 0, 0, 196, 197, 198, 199, 200, 201, 202,
+    203, 204, 205, 206, 207, 208, 196, 197, 198, 209, 210, 211, 212, 213, 214,
+    215, 216, 217, 218, 196, 197, 198, 199, 200, 211, 202, 203, 204, 215, 216,
+    217, 218, 196, 197, 198, 219, 220, 221, 222, 223, 224, 225, 226, 227, 228,
+    229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240, 241, 242, 243,
+    244, 245, 246, 247, 248, 249, 250, 251, 250, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 103, 252, 253, 254, 255,
+    256, 257, 258, 259, 260, 261, 262, 263, 264, 265, 266, 267, 268, 269, 270,
+    271, 272, 273, 274, 275, 276, 277, 278, 279, 280, 281, 282, 283, 284, 285,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101, 101,
+    101, 101, 101, 101, 101,
+};
+
+static const uint16_t utf8_norm_leaves[4576] = {
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 2, 0, 0, 0, 0, 3, 4, 0, 0, 0, 0, 0, 5, 6, 0, 0, 0, 0, 0, 7, 7,
+    7, 7, 7, 7, 0, 8, 9, 9, 9, 9, 10, 10, 10, 10, 0, 11, 12, 12, 12, 12, 12, 0,
+    12, 13, 13, 13, 13, 14, 0, 0, 0, 11, 12, 12, 12, 12, 12, 0, 12, 13, 13, 13,
+    13, 14, 0, 14, 7, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 8, 8, 15, 15, 15, 15, 9,
+    9, 9, 9, 9, 9, 9, 9, 9, 9, 16, 16, 16, 16, 16, 16, 16, 16, 17, 17, 17, 17,
+    10, 10, 10, 10, 10, 10, 10, 10, 10, 18, 0, 0, 19, 19, 20, 20, 0, 21, 21, 21,
+    21, 21, 21, 0, 0, 21, 21, 11, 11, 11, 11, 11, 11, 0, 0, 0, 12, 12, 12, 12,
+    12, 12, 0, 0, 22, 22, 22, 22, 22, 22, 23, 23, 23, 23, 23, 23, 23, 23, 24,
+    24, 24, 24, 24, 24, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 25, 25,
+    14, 14, 14, 26, 26, 26, 26, 26, 26, 0, 27, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 10, 0, 0, 0, 0, 0, 0, 0, 0, 12, 12, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 13, 13, 0, 0, 0, 0, 26, 26, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 7, 10, 10, 12, 12, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 13, 0, 7, 7, 7, 7, 28, 28, 16, 16, 16, 16,
+    20, 20, 12, 12, 12, 12, 29, 29, 19, 0, 0, 0, 16, 16, 0, 0, 11, 11, 7, 7, 28,
+    28, 30, 30, 7, 7, 7, 7, 9, 9, 9, 9, 10, 10, 10, 10, 12, 12, 12, 12, 22, 22,
+    22, 22, 13, 13, 13, 13, 23, 23, 24, 24, 0, 0, 17, 17, 0, 0, 0, 0, 0, 0, 7,
+    7, 9, 9, 12, 12, 12, 12, 12, 12, 12, 12, 14, 14, 0, 0, 0, 0, 0, 0, 0, 8, 8,
+    0, 0, 0, 0, 0, 0, 27, 0, 0, 9, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 31, 0, 0, 0, 0, 0, 0, 10, 18, 0, 0, 0, 0,
+    0, 0, 32, 33, 34, 35, 36, 37, 38, 39, 40, 0, 0, 0, 0, 0, 0, 0, 41, 42, 43,
+    44, 45, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 2, 0, 0, 0, 0, 47, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 48, 0, 49, 50, 51, 0, 52, 0, 53, 54, 51, 1, 55, 0, 0, 56, 57, 32, 0,
+    18, 58, 0, 59, 60, 0, 6, 0, 61, 0, 0, 62, 40, 0, 44, 0, 0, 51, 53, 48, 49,
+    50, 51, 53, 1, 0, 0, 0, 0, 0, 0, 0, 18, 58, 0, 0, 63, 0, 6, 0, 61, 0, 0, 0,
+    64, 0, 0, 0, 0, 51, 53, 52, 53, 54, 0, 0, 0, 40, 65, 65, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 58, 61, 66, 0, 0, 0, 0, 0, 0, 66, 0, 0, 0, 0, 0, 0, 67, 67,
+    0, 68, 0, 43, 18, 69, 34, 0, 0, 0, 70, 71, 72, 0, 1, 0, 55, 0, 0, 56, 0, 0,
+    0, 71, 58, 0, 59, 32, 6, 0, 61, 73, 62, 0, 0, 44, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 1, 0, 0, 0, 0, 56, 0, 0, 0, 71, 0, 0, 0, 0, 6, 0, 61, 73, 0, 40, 0, 44,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 74, 74, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 40, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 32, 0, 0, 0, 0, 18, 75, 75, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 42,
+    76, 76, 76, 76, 0, 0, 67, 67, 0, 0, 77, 77, 75, 75, 78, 78, 0, 0, 71, 71,
+    71, 71, 79, 79, 0, 0, 80, 80, 81, 81, 72, 72, 72, 72, 72, 72, 82, 82, 0, 0,
+    83, 83, 0, 0, 0, 0, 0, 0, 0, 84, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 85, 0, 39, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 86, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 46, 46, 46, 46, 46, 46, 46, 46, 46, 46,
+    46, 46, 46, 46, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 87, 55, 0, 84,
+    56, 88, 31, 32, 18, 34, 58, 42, 59, 60, 0, 6, 89, 61, 35, 62, 64, 39, 1, 90,
+    1, 91, 55, 84, 56, 92, 93, 94, 31, 0, 58, 59, 95, 6, 96, 97, 98, 61, 62, 64,
+    99, 100, 63, 101, 102, 103, 104, 105, 106, 18, 35, 64, 63, 102, 103, 61,
+    105, 106, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 107, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 108, 73, 109, 110, 94, 111, 112, 31, 113,
+    114, 18, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 57, 136, 137, 138, 139, 7, 7, 27,
+    27, 27, 27, 27, 27, 8, 8, 15, 15, 15, 15, 15, 15, 15, 15, 15, 15, 9, 9, 9,
+    9, 9, 9, 9, 9, 9, 9, 140, 140, 16, 16, 17, 17, 17, 17, 17, 17, 17, 17, 17,
+    17, 10, 10, 10, 10, 20, 20, 20, 20, 20, 20, 21, 21, 21, 21, 21, 21, 21, 21,
+    141, 141, 141, 141, 141, 141, 11, 11, 11, 11, 11, 11, 11, 11, 12, 12, 12,
+    12, 12, 12, 12, 12, 142, 142, 142, 142, 22, 22, 22, 22, 22, 22, 22, 22, 23,
+    23, 23, 23, 23, 23, 23, 23, 23, 23, 24, 24, 24, 24, 24, 24, 24, 24, 13, 13,
+    13, 13, 13, 13, 13, 13, 13, 13, 143, 143, 143, 143, 25, 25, 25, 25, 25, 25,
+    25, 25, 25, 25, 144, 144, 144, 144, 14, 14, 26, 26, 26, 26, 26, 26, 17, 24,
+    25, 14, 0, 23, 0, 0, 0, 0, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 9, 10,
+    10, 10, 10, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12, 12,
+    12, 12, 12, 12, 12, 12, 12, 12, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13, 13,
+    13, 13, 13, 14, 14, 14, 14, 14, 14, 14, 14, 0, 0, 0, 0, 0, 0, 48, 48, 48,
+    48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 48, 49, 49, 49, 49, 49, 49,
+    0, 0, 49, 49, 49, 49, 49, 49, 0, 0, 50, 50, 50, 50, 50, 50, 50, 50, 50, 50,
+    50, 50, 50, 50, 50, 50, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51, 51,
+    51, 51, 51, 52, 52, 52, 52, 52, 52, 0, 0, 52, 52, 52, 52, 52, 52, 0, 0, 53,
+    53, 53, 53, 53, 53, 53, 53, 0, 53, 0, 53, 0, 53, 0, 53, 54, 54, 54, 54, 54,
+    54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 54, 48, 48, 49, 49, 50, 50, 51, 51,
+    52, 52, 53, 53, 54, 54, 0, 0, 48, 48, 48, 48, 48, 0, 48, 48, 48, 48, 48, 48,
+    48, 0, 0, 0, 0, 0, 50, 50, 50, 0, 50, 50, 49, 49, 50, 50, 50, 0, 0, 0, 51,
+    51, 51, 51, 0, 0, 51, 51, 51, 51, 51, 51, 0, 0, 0, 0, 53, 53, 53, 53, 145,
+    145, 53, 53, 53, 53, 53, 53, 145, 0, 0, 0, 0, 0, 54, 54, 54, 0, 54, 54, 52,
+    52, 54, 54, 54, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 0, 2,
+    2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 146, 18, 0, 0, 147, 148, 149,
+    150, 151, 152, 0, 0, 0, 0, 0, 60, 146, 5, 3, 4, 147, 148, 149, 150, 151,
+    152, 0, 0, 0, 0, 0, 0, 1, 56, 6, 44, 92, 32, 58, 42, 59, 60, 61, 43, 62, 0,
+    0, 0, 46, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 73, 0, 0, 0, 0,
+    93, 0, 0, 31, 32, 32, 32, 32, 153, 18, 18, 42, 42, 0, 60, 0, 0, 0, 61, 85,
+    35, 35, 35, 0, 0, 0, 0, 0, 0, 57, 0, 0, 0, 57, 0, 0, 7, 55, 73, 0, 56, 56,
+    111, 0, 59, 6, 154, 155, 156, 157, 18, 0, 0, 158, 103, 103, 158, 0, 0, 0, 0,
+    0, 84, 84, 56, 18, 34, 0, 0, 0, 0, 0, 0, 18, 0, 0, 0, 63, 0, 0, 0, 0, 44, 0,
+    0, 42, 73, 84, 59, 5, 3, 4, 147, 148, 149, 150, 151, 152, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 146, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 34, 63, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 159,
+    0, 0, 0, 0, 0, 0, 0, 0, 160, 161, 162, 0, 0, 0, 0, 0, 0, 163, 164, 165, 166,
+    167, 168, 169, 170, 171, 172, 173, 174, 175, 176, 177, 178, 179, 180, 181,
+    182, 183, 184, 185, 186, 187, 188, 189, 190, 191, 192, 193, 194, 195, 196,
+    197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207, 208, 209, 210, 211,
+    212, 213, 2, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223, 224, 225,
+    226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239, 240,
+    241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+    0, 0, 0, 256, 257, 258, 259, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 256, 257, 258,
+    259, 260, 261, 262, 263, 264, 160, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 265, 266, 0, 0, 267, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 73, 111, 85, 0, 0, 0, 153, 268, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 269, 270, 271, 272, 0, 0, 0, 0, 0, 0, 0, 0, 0, 273, 0, 0,
+    0, 0, 0, 0, 274, 275, 276, 277, 278, 279, 280, 281, 281, 282, 283, 284, 285,
+    286, 287, 288, 289, 290, 291, 292, 293, 294, 295, 296, 297, 298, 299, 300,
+    301, 302, 303, 304, 305, 306, 307, 308, 309, 310, 311, 312, 313, 314, 315,
+    316, 317, 318, 319, 320, 321, 322, 323, 324, 325, 326, 327, 328, 329, 330,
+    331, 332, 333, 334, 335, 336, 337, 338, 339, 340, 341, 342, 343, 344, 345,
+    346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358, 359, 360,
+    361, 362, 363, 364, 293, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374,
+    375, 376, 377, 378, 379, 380, 381, 382, 383, 384, 385, 386, 387, 388, 389,
+    390, 391, 392, 393, 394, 395, 396, 397, 398, 399, 400, 401, 402, 403, 404,
+    405, 406, 407, 408, 409, 410, 411, 412, 413, 414, 415, 416, 417, 418, 419,
+    420, 421, 422, 423, 424, 425, 426, 427, 428, 429, 430, 431, 432, 383, 433,
+    434, 435, 436, 437, 438, 439, 440, 367, 441, 442, 443, 444, 445, 446, 447,
+    448, 449, 450, 451, 452, 453, 454, 455, 456, 457, 458, 459, 460, 293, 461,
+    462, 463, 464, 465, 466, 467, 468, 469, 470, 471, 472, 473, 474, 475, 476,
+    477, 478, 479, 480, 481, 482, 483, 484, 485, 486, 487, 369, 488, 489, 490,
+    491, 492, 493, 494, 495, 496, 497, 498, 499, 500, 501, 502, 503, 504, 505,
+    506, 507, 508, 509, 510, 511, 512, 513, 514, 515, 516, 517, 518, 519, 520,
+    521, 522, 523, 524, 525, 526, 527, 528, 529, 530, 531, 532, 533, 534, 535,
+    536, 537, 0, 0, 538, 0, 539, 0, 0, 540, 541, 542, 543, 544, 545, 546, 547,
+    548, 549, 0, 550, 0, 551, 0, 0, 552, 553, 0, 0, 0, 554, 555, 556, 557, 558,
+    559, 560, 561, 562, 563, 564, 565, 566, 567, 568, 569, 570, 571, 572, 573,
+    574, 575, 576, 577, 578, 579, 580, 581, 582, 583, 584, 585, 586, 587, 588,
+    589, 590, 591, 592, 593, 594, 595, 596, 597, 598, 422, 599, 600, 601, 602,
+    603, 604, 604, 605, 606, 607, 608, 609, 610, 611, 612, 552, 613, 614, 615,
+    616, 617, 618, 0, 0, 619, 620, 621, 622, 623, 624, 625, 626, 566, 627, 628,
+    629, 538, 630, 631, 632, 633, 634, 635, 636, 637, 638, 639, 640, 641, 575,
+    642, 576, 643, 644, 645, 646, 647, 539, 314, 648, 649, 650, 384, 471, 651,
+    652, 583, 653, 584, 654, 655, 656, 541, 657, 658, 659, 660, 661, 542, 662,
+    663, 664, 665, 666, 667, 598, 668, 669, 422, 670, 602, 671, 672, 673, 674,
+    675, 607, 676, 551, 677, 608, 365, 678, 609, 679, 611, 680, 681, 682, 683,
+    684, 613, 547, 685, 614, 686, 615, 687, 281, 688, 689, 690, 691, 692, 693,
+    694, 695, 696, 697, 698, 0, 0, 0, 0, 0, 0, 699, 154, 157, 700, 701, 702,
+    703, 704, 705, 0, 0, 0, 0, 0, 0, 0, 706, 706, 707, 707, 707, 707, 708, 708,
+    708, 708, 709, 709, 709, 709, 710, 710, 710, 710, 711, 711, 711, 711, 712,
+    712, 712, 712, 713, 713, 713, 713, 714, 714, 714, 714, 715, 715, 715, 715,
+    716, 716, 716, 716, 717, 717, 717, 717, 718, 718, 718, 718, 719, 719, 720,
+    720, 721, 721, 722, 722, 723, 723, 724, 724, 725, 725, 725, 725, 726, 726,
+    726, 726, 727, 727, 727, 727, 728, 728, 728, 728, 729, 729, 730, 730, 730,
+    730, 731, 731, 732, 732, 732, 732, 733, 733, 733, 733, 734, 734, 735, 735,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 736, 736, 736, 736, 737,
+    737, 738, 738, 739, 739, 0, 740, 740, 741, 741, 742, 742, 743, 743, 743,
+    743, 744, 744, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 745,
+    745, 745, 745, 746, 747, 747, 748, 748, 749, 749, 750, 750, 751, 751, 751,
+    751, 752, 752, 753, 753, 753, 753, 754, 754, 755, 755, 755, 755, 756, 756,
+    756, 756, 757, 757, 757, 757, 758, 758, 758, 758, 759, 759, 759, 759, 760,
+    760, 761, 761, 762, 762, 763, 763, 764, 764, 764, 764, 765, 765, 765, 765,
+    766, 766, 766, 766, 767, 767, 767, 767, 768, 768, 768, 768, 769, 769, 769,
+    769, 770, 770, 770, 770, 771, 771, 771, 771, 772, 772, 772, 772, 773, 773,
+    773, 773, 774, 774, 774, 774, 775, 775, 775, 775, 776, 776, 776, 776, 777,
+    777, 777, 777, 778, 778, 778, 778, 779, 779, 744, 744, 780, 780, 780, 780,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 55, 73, 84, 56, 111, 31, 32, 18, 34,
+    58, 42, 59, 60, 6, 61, 85, 35, 43, 62, 64, 63, 39, 44, 40, 57, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 781, 782, 783, 784, 785, 786, 787, 788, 789, 790, 791,
+    792, 793, 794, 795, 796, 797, 798, 799, 800, 801, 802, 803, 804, 805, 806,
+    807, 808, 809, 810, 811, 812, 813, 814, 815, 816, 817, 818, 819, 820, 821,
+    822, 823, 824, 825, 826, 827, 828, 829, 830, 831, 832, 833, 834, 835, 836,
+    837, 838, 2, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174,
+    175, 176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189,
+    190, 191, 192, 0, 0, 0, 193, 194, 195, 196, 197, 198, 0, 0, 199, 200, 201,
+    202, 203, 204, 0, 0, 205, 206, 207, 208, 209, 210, 0, 0, 211, 212, 213, 0,
+    0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 839, 840, 87, 841,
+    842, 0, 843, 844, 845, 846, 847, 848, 849, 850, 851, 852, 853, 854, 855,
+    856, 153, 857, 858, 859, 860, 861, 862, 863, 864, 865, 866, 867, 868, 869,
+    870, 871, 85, 872, 873, 874, 875, 876, 877, 878, 879, 880, 881, 882, 0, 883,
+    884, 885, 886, 887, 888, 889, 890, 891, 0, 0, 0, 0, 0, 2, 2, 2, 2, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0,
+    1, 55, 73, 84, 56, 111, 31, 32, 18, 34, 58, 42, 59, 60, 6, 61, 85, 35, 43,
+    62, 64, 63, 39, 44, 40, 57, 1, 55, 73, 84, 56, 111, 31, 32, 18, 34, 58, 42,
+    59, 60, 6, 61, 85, 35, 43, 62, 64, 63, 39, 44, 40, 57, 1, 55, 73, 84, 56,
+    111, 31, 32, 18, 34, 58, 42, 59, 60, 6, 61, 85, 35, 43, 62, 64, 63, 39, 44,
+    40, 57, 1, 55, 73, 84, 56, 111, 31, 0, 18, 34, 58, 42, 59, 60, 6, 61, 85,
+    35, 43, 62, 64, 63, 39, 44, 40, 57, 1, 55, 73, 84, 56, 111, 31, 32, 18, 34,
+    58, 42, 59, 60, 6, 61, 85, 35, 43, 62, 64, 63, 39, 44, 40, 57, 1, 55, 73,
+    84, 56, 111, 31, 32, 18, 34, 58, 42, 59, 60, 6, 61, 85, 35, 43, 62, 64, 63,
+    39, 44, 40, 57, 1, 0, 73, 84, 0, 0, 31, 0, 0, 34, 58, 0, 0, 60, 6, 61, 85,
+    0, 43, 62, 64, 63, 39, 44, 40, 57, 1, 55, 73, 84, 0, 111, 0, 32, 18, 34, 58,
+    42, 59, 60, 0, 61, 85, 35, 43, 62, 64, 63, 39, 44, 40, 57, 39, 44, 40, 57,
+    1, 55, 0, 84, 56, 111, 31, 0, 0, 34, 58, 42, 59, 60, 6, 61, 85, 0, 43, 62,
+    64, 63, 39, 44, 40, 0, 1, 55, 73, 84, 56, 111, 31, 32, 18, 34, 58, 42, 59,
+    60, 6, 61, 85, 35, 43, 62, 64, 63, 39, 44, 40, 57, 1, 55, 0, 84, 56, 111,
+    31, 0, 18, 34, 58, 42, 59, 0, 6, 0, 0, 0, 43, 62, 64, 63, 39, 44, 40, 0, 1,
+    55, 73, 84, 56, 111, 31, 32, 18, 34, 58, 42, 59, 60, 6, 61, 85, 35, 43, 62,
+    64, 63, 39, 44, 40, 57, 1, 55, 73, 84, 56, 111, 31, 32, 18, 34, 58, 42, 59,
+    60, 6, 61, 85, 35, 43, 62, 64, 63, 39, 44, 40, 57, 1, 55, 73, 84, 56, 111,
+    31, 32, 18, 34, 58, 42, 59, 60, 6, 61, 85, 35, 43, 62, 64, 63, 39, 44, 40,
+    57, 39, 44, 40, 57, 18, 892, 0, 0, 1, 55, 103, 104, 56, 57, 32, 139, 18, 58,
+    893, 59, 60, 894, 6, 158, 61, 139, 66, 62, 40, 105, 44, 895, 896, 0, 1, 102,
+    103, 104, 897, 898, 899, 139, 18, 58, 893, 900, 63, 894, 6, 158, 61, 66, 66,
+    901, 64, 105, 106, 895, 896, 0, 897, 139, 58, 105, 61, 158, 1, 55, 103, 104,
+    56, 57, 32, 139, 18, 58, 893, 59, 60, 894, 6, 158, 61, 139, 66, 62, 40, 105,
+    44, 895, 896, 0, 1, 102, 103, 104, 897, 898, 899, 139, 18, 58, 893, 900, 63,
+    894, 6, 158, 61, 66, 66, 901, 64, 105, 106, 895, 896, 0, 897, 139, 58, 105,
+    61, 158, 1, 55, 103, 104, 56, 57, 32, 139, 18, 58, 893, 59, 60, 894, 6, 158,
+    61, 139, 66, 62, 40, 105, 44, 895, 896, 0, 1, 102, 103, 104, 897, 898, 899,
+    139, 18, 58, 893, 900, 63, 894, 6, 158, 61, 66, 66, 901, 64, 105, 106, 895,
+    896, 0, 897, 139, 58, 105, 61, 158, 1, 55, 103, 104, 56, 57, 32, 139, 18,
+    58, 893, 59, 60, 894, 6, 158, 61, 139, 66, 62, 40, 105, 44, 895, 896, 0, 1,
+    102, 103, 104, 897, 898, 899, 139, 18, 58, 893, 900, 63, 894, 6, 158, 61,
+    66, 66, 901, 64, 105, 106, 895, 896, 0, 897, 139, 58, 105, 61, 158, 1, 55,
+    103, 104, 56, 57, 32, 139, 18, 58, 893, 59, 60, 894, 6, 158, 61, 139, 66,
+    62, 40, 105, 44, 895, 896, 0, 1, 102, 103, 104, 897, 898, 899, 139, 18, 58,
+    893, 900, 63, 894, 6, 158, 61, 66, 66, 901, 64, 105, 106, 895, 896, 0, 897,
+    139, 58, 105, 61, 158, 902, 902, 0, 0, 146, 5, 3, 4, 147, 148, 149, 150,
+    151, 152, 146, 5, 3, 4, 147, 148, 149, 150, 151, 152, 146, 5, 3, 4, 147,
+    148, 149, 150, 151, 152, 146, 5, 3, 4, 147, 148, 149, 150, 151, 152, 146, 5,
+    3, 4, 147, 148, 149, 150, 151, 152, 752, 753, 757, 760, 0, 779, 763, 758,
+    768, 780, 774, 775, 776, 777, 764, 770, 772, 766, 773, 762, 765, 755, 756,
+    759, 761, 767, 769, 771, 903, 729, 904, 905, 0, 753, 757, 0, 778, 0, 0, 758,
+    0, 780, 774, 775, 776, 777, 764, 770, 772, 766, 773, 0, 765, 755, 756, 759,
+    0, 767, 0, 771, 0, 0, 0, 0, 0, 0, 757, 0, 0, 0, 0, 758, 0, 780, 0, 775, 0,
+    777, 764, 770, 0, 766, 773, 0, 765, 0, 0, 759, 0, 767, 0, 771, 0, 729, 0,
+    905, 0, 753, 757, 0, 778, 0, 0, 758, 768, 780, 774, 0, 776, 777, 764, 770,
+    772, 766, 773, 0, 765, 755, 756, 759, 0, 767, 769, 771, 903, 0, 904, 0, 752,
+    753, 757, 760, 778, 779, 763, 758, 768, 780, 0, 775, 776, 777, 764, 770,
+    772, 766, 773, 762, 765, 755, 756, 759, 761, 767, 769, 771, 0, 0, 0, 0, 0,
+    753, 757, 760, 0, 779, 763, 758, 768, 780, 0, 775, 776, 777, 764, 770, 906,
+    907, 908, 909, 910, 560, 911, 912, 913, 914, 561, 915, 916, 917, 562, 918,
+    919, 920, 921, 922, 923, 924, 925, 926, 927, 928, 929, 620, 930, 931, 932,
+    933, 934, 935, 936, 937, 938, 625, 563, 564, 626, 939, 940, 371, 941, 565,
+    942, 943, 944, 945, 945, 945, 946, 947, 948, 949, 950, 951, 952, 953, 954,
+    955, 956, 957, 958, 959, 960, 961, 962, 963, 963, 628, 964, 965, 966, 967,
+    567, 968, 969, 970, 524, 971, 972, 973, 974, 975, 976, 977, 978, 979, 980,
+    981, 982, 983, 984, 985, 986, 987, 988, 989, 990, 991, 992, 993, 994, 995,
+    996, 996, 997, 998, 999, 367, 1000, 1001, 1002, 1003, 1004, 1005, 1006,
+    1007, 572, 1008, 1009, 1010, 1011, 1012, 1013, 1014, 1015, 1016, 1017, 1018,
+    1019, 1020, 1021, 1022, 1023, 1024, 1025, 1026, 1027, 1028, 313, 1029, 1030,
+    1031, 1031, 1032, 1033, 1033, 1034, 1035, 1036, 1037, 1038, 1039, 1040,
+    1041, 1042, 1043, 1044, 1045, 1046, 573, 1047, 1048, 1049, 1050, 640, 1050,
+    1051, 575, 1052, 1053, 1054, 1055, 576, 286, 1056, 1057, 1058, 1059, 1060,
+    1061, 1062, 1063, 1064, 1065, 1066, 1067, 1068, 1069, 1070, 1071, 1072,
+    1073, 1074, 1075, 1076, 1077, 577, 1078, 1079, 1080, 1081, 1082, 1083, 579,
+    1084, 1085, 1086, 1087, 1088, 1089, 1090, 1091, 314, 648, 1092, 1093, 1094,
+    1095, 1096, 1097, 1098, 1099, 580, 1100, 1101, 1102, 1103, 691, 1104, 1105,
+    1106, 1107, 1108, 1109, 1110, 1111, 1112, 1113, 1114, 1115, 1116, 384, 1117,
+    1118, 1119, 1120, 1121, 1122, 1123, 1124, 1125, 1126, 1127, 581, 471, 1128,
+    1129, 1130, 1131, 1132, 1133, 1134, 1135, 652, 1136, 1137, 1138, 1139, 1140,
+    1141, 1142, 1143, 653, 1144, 1145, 1146, 1147, 1148, 1149, 1150, 1151, 1152,
+    1153, 1154, 1155, 655, 1156, 1157, 1158, 1159, 1160, 1161, 1162, 1163, 1164,
+    1165, 1166, 1166, 1167, 1168, 657, 1169, 1170, 1171, 1172, 1173, 1174, 1175,
+    370, 1176, 1177, 1178, 1179, 1180, 1181, 1182, 663, 1183, 1184, 1185, 1186,
+    1187, 1188, 1188, 664, 693, 1189, 1190, 1191, 1192, 1193, 332, 666, 1194,
+    1195, 592, 1196, 1197, 546, 1198, 1199, 596, 1200, 1201, 1202, 1203, 1203,
+    1204, 1205, 1206, 1207, 1208, 1209, 1210, 1211, 1212, 1213, 1214, 1215,
+    1216, 1217, 1218, 1219, 1220, 1221, 1222, 1223, 1224, 1225, 1226, 1227,
+    1228, 1229, 1230, 602, 1231, 1232, 1233, 1234, 1235, 1236, 1237, 1238, 1239,
+    1240, 1241, 1242, 1243, 1244, 1245, 1246, 1032, 1247, 1248, 1249, 1250,
+    1251, 1252, 1253, 1254, 1255, 1256, 1257, 1258, 388, 1259, 1260, 1261, 1262,
+    1263, 1264, 605, 1265, 1266, 1267, 1268, 1269, 1270, 1271, 1272, 1273, 1274,
+    1275, 1276, 1277, 1278, 1279, 1280, 1281, 1282, 1283, 1284, 327, 1285, 1286,
+    1287, 1288, 1289, 1290, 673, 1291, 1292, 1293, 1294, 1295, 1296, 1297, 1298,
+    1299, 1300, 1301, 1302, 1303, 1304, 1305, 1306, 1307, 1308, 1309, 1310, 678,
+    679, 1311, 1312, 1313, 1314, 1315, 1316, 1317, 1318, 1319, 1320, 1321, 1322,
+    1323, 680, 1324, 1325, 1326, 1327, 1328, 1329, 1330, 1331, 1332, 1333, 1334,
+    1335, 1336, 1337, 1338, 1339, 1340, 1341, 1342, 1343, 1344, 1345, 1346,
+    1347, 1348, 1349, 1350, 1351, 1352, 1353, 686, 686, 1354, 1355, 1356, 1357,
+    1358, 1359, 1360, 1361, 1362, 1363, 687, 1364, 1365, 1366, 1367, 1368, 1369,
+    1370, 1371, 1372, 1373, 1374, 1375, 1376, 1377, 1378, 1379, 1380, 1381,
+    1382, 0, 0,
+};
+
+static const uint32_t utf8_norms[1383] = {
+    0x00000000, 0x04000061, 0x08000000, 0x04000032, 0x04000033, 0x04000031,
+    0x0400006f, 0x02000061, 0x02000063, 0x02000065, 0x02000069, 0x0200006e,
+    0x0200006f, 0x02000075, 0x02000079, 0x02000064, 0x02000067, 0x02000068,
+    0x04000069, 0x0200006a, 0x0200006b, 0x0200006c, 0x02000072, 0x02000073,
+    0x02000074, 0x02000077, 0x0200007a, 0x02000062, 0x020000e6, 0x02000292,
+    0x020000f8, 0x04000067, 0x04000068, 0x04000266, 0x0400006a, 0x04000072,
+    0x04000279, 0x0400027b, 0x04000281, 0x04000077, 0x04000079, 0x04000263,
+    0x0400006c, 0x04000073, 0x04000078, 0x04000295, 0x02000000, 0x020002b9,
+    0x020003b1, 0x020003b5, 0x020003b7, 0x020003b9, 0x020003bf, 0x020003c5,
+    0x020003c9, 0x04000062, 0x04000065, 0x0400007a, 0x0400006b, 0x0400006d,
+    0x0400006e, 0x04000070, 0x04000074, 0x04000076, 0x04000075, 0x020003d2,
+    0x040003c3, 0x02000435, 0x02000433, 0x02000456, 0x0200043a, 0x02000438,
+    0x02000443, 0x04000063, 0x02000475, 0x02000436, 0x02000430, 0x020004d9,
+    0x02000437, 0x0200043e, 0x020004e9, 0x0200044d, 0x02000447, 0x0200044b,
+    0x04000064, 0x04000071, 0x040010dc, 0x040000e6, 0x040001dd, 0x04000223,
+    0x04000250, 0x04001d02, 0x04000259, 0x0400025b, 0x0400025c, 0x0400014b,
+    0x04000254, 0x04001d16, 0x04001d17, 0x04001d1d, 0x0400026f, 0x04001d25,
+    0x040003b2, 0x040003b3, 0x040003b4, 0x040003c6, 0x040003c7, 0x0400043d,
+    0x04000252, 0x04000255, 0x040000f0, 0x04000066, 0x0400025f, 0x04000265,
+    0x04000268, 0x0400026a, 0x04001d7b, 0x0400029d, 0x0400026d, 0x04001d85,
+    0x0400029f, 0x04000271, 0x04000270, 0x04000272, 0x04000273, 0x04000274,
+    0x04000275, 0x04000278, 0x04000282, 0x04000283, 0x040001ab, 0x04000289,
+    0x0400028a, 0x04001d1c, 0x0400028b, 0x0400028c, 0x04000290, 0x04000291,
+    0x04000292, 0x040003b8, 0x02000066, 0x0200006d, 0x02000070, 0x02000076,
+    0x02000078, 0x020003c1, 0x04000030, 0x04000034, 0x04000035, 0x04000036,
+    0x04000037, 0x04000038, 0x04000039, 0x04000127, 0x040005d0, 0x040005d1,
+    0x040005d2, 0x040005d3, 0x040003c0, 0x04002d61, 0x04005341, 0x04005344,
+    0x04005345, 0x04001100, 0x04001101, 0x040011aa, 0x04001102, 0x040011ac,
+    0x040011ad, 0x04001103, 0x04001104, 0x04001105, 0x040011b0, 0x040011b1,
+    0x040011b2, 0x040011b3, 0x040011b4, 0x040011b5, 0x0400111a, 0x04001106,
+    0x04001107, 0x04001108, 0x04001121, 0x04001109, 0x0400110a, 0x0400110b,
+    0x0400110c, 0x0400110d, 0x0400110e, 0x0400110f, 0x04001110, 0x04001111,
+    0x04001112, 0x04001161, 0x04001162, 0x04001163, 0x04001164, 0x04001165,
+    0x04001166, 0x04001167, 0x04001168, 0x04001169, 0x0400116a, 0x0400116b,
+    0x0400116c, 0x0400116d, 0x0400116e, 0x0400116f, 0x04001170, 0x04001171,
+    0x04001172, 0x04001173, 0x04001174, 0x04001175, 0x04001114, 0x04001115,
+    0x040011c7, 0x040011c8, 0x040011cc, 0x040011ce, 0x040011d3, 0x040011d7,
+    0x040011d9, 0x0400111c, 0x040011dd, 0x040011df, 0x0400111d, 0x0400111e,
+    0x04001120, 0x04001122, 0x04001123, 0x04001127, 0x04001129, 0x0400112b,
+    0x0400112c, 0x0400112d, 0x0400112e, 0x0400112f, 0x04001132, 0x04001136,
+    0x04001140, 0x04001147, 0x0400114c, 0x040011f1, 0x040011f2, 0x04001157,
+    0x04001158, 0x04001159, 0x04001184, 0x04001185, 0x04001188, 0x04001191,
+    0x04001192, 0x04001194, 0x0400119e, 0x040011a1, 0x04004e00, 0x04004e8c,
+    0x04004e09, 0x040056db, 0x04004e94, 0x0400516d, 0x04004e03, 0x0400516b,
+    0x04004e5d, 0x0400044a, 0x0400044c, 0x0400a76f, 0x04000153, 0x0400a727,
+    0x0400ab37, 0x0400026b, 0x0400ab52, 0x0400028d, 0x02008c48, 0x020066f4,
+    0x02008eca, 0x02008cc8, 0x02006ed1, 0x02004e32, 0x020053e5, 0x02009f9c,
+    0x02005951, 0x020091d1, 0x02005587, 0x02005948, 0x020061f6, 0x02007669,
+    0x02007f85, 0x0200863f, 0x020087ba, 0x020088f8, 0x0200908f, 0x02006a02,
+    0x02006d1b, 0x020070d9, 0x020073de, 0x0200843d, 0x0200916a, 0x020099f1,
+    0x02004e82, 0x02005375, 0x02006b04, 0x0200721b, 0x0200862d, 0x02009e1e,
+    0x02005d50, 0x02006feb, 0x020085cd, 0x02008964, 0x020062c9, 0x020081d8,
+    0x0200881f, 0x02005eca, 0x02006717, 0x02006d6a, 0x020072fc, 0x020090ce,
+    0x02004f86, 0x020051b7, 0x020052de, 0x020064c4, 0x02006ad3, 0x02007210,
+    0x020076e7, 0x02008001, 0x02008606, 0x0200865c, 0x02008def, 0x02009732,
+    0x02009b6f, 0x02009dfa, 0x0200788c, 0x0200797f, 0x02007da0, 0x020083c9,
+    0x02009304, 0x02009e7f, 0x02008ad6, 0x020058df, 0x02005f04, 0x02007c60,
+    0x0200807e, 0x02007262, 0x020078ca, 0x02008cc2, 0x020096f7, 0x020058d8,
+    0x02005c62, 0x02006a13, 0x02006dda, 0x02006f0f, 0x02007d2f, 0x02007e37,
+    0x0200964b, 0x020052d2, 0x0200808b, 0x020051dc, 0x020051cc, 0x02007a1c,
+    0x02007dbe, 0x020083f1, 0x02009675, 0x02008b80, 0x020062cf, 0x02008afe,
+    0x02004e39, 0x02005be7, 0x02006012, 0x02007387, 0x02007570, 0x02005317,
+    0x020078fb, 0x02004fbf, 0x02005fa9, 0x02004e0d, 0x02006ccc, 0x02006578,
+    0x02007d22, 0x020053c3, 0x0200585e, 0x02007701, 0x02008449, 0x02008aaa,
+    0x02006bba, 0x02008fb0, 0x02006c88, 0x020062fe, 0x020082e5, 0x020063a0,
+    0x02007565, 0x02004eae, 0x02005169, 0x020051c9, 0x02006881, 0x02007ce7,
+    0x0200826f, 0x02008ad2, 0x020091cf, 0x020052f5, 0x02005442, 0x02005973,
+    0x02005eec, 0x020065c5, 0x02006ffe, 0x0200792a, 0x020095ad, 0x02009a6a,
+    0x02009e97, 0x02009ece, 0x0200529b, 0x020066c6, 0x02006b77, 0x02008f62,
+    0x02005e74, 0x02006190, 0x02006200, 0x0200649a, 0x02006f23, 0x02007149,
+    0x02007489, 0x020079ca, 0x02007df4, 0x0200806f, 0x02008f26, 0x020084ee,
+    0x02009023, 0x0200934a, 0x02005217, 0x020052a3, 0x020054bd, 0x020070c8,
+    0x020088c2, 0x02005ec9, 0x02005ff5, 0x0200637b, 0x02006bae, 0x02007c3e,
+    0x02007375, 0x02004ee4, 0x020056f9, 0x02005dba, 0x0200601c, 0x020073b2,
+    0x02007469, 0x02007f9a, 0x02008046, 0x02009234, 0x020096f6, 0x02009748,
+    0x02009818, 0x02004f8b, 0x020079ae, 0x020091b4, 0x020096b8, 0x020060e1,
+    0x02004e86, 0x020050da, 0x02005bee, 0x02005c3f, 0x02006599, 0x020071ce,
+    0x02007642, 0x020084fc, 0x0200907c, 0x02009f8d, 0x02006688, 0x0200962e,
+    0x02005289, 0x0200677b, 0x020067f3, 0x02006d41, 0x02006e9c, 0x02007409,
+    0x02007559, 0x0200786b, 0x02007d10, 0x0200985e, 0x0200516d, 0x0200622e,
+    0x02009678, 0x0200502b, 0x02005d19, 0x02006dea, 0x02008f2a, 0x02005f8b,
+    0x02006144, 0x02006817, 0x02009686, 0x02005229, 0x0200540f, 0x02005c65,
+    0x02006613, 0x0200674e, 0x020068a8, 0x02006ce5, 0x02007406, 0x020075e2,
+    0x02007f79, 0x020088cf, 0x020088e1, 0x020091cc, 0x020096e2, 0x0200533f,
+    0x02006eba, 0x0200541d, 0x020071d0, 0x02007498, 0x020085fa, 0x020096a3,
+    0x02009c57, 0x02009e9f, 0x02006797, 0x02006dcb, 0x020081e8, 0x02007acb,
+    0x02007b20, 0x02007c92, 0x020072c0, 0x02007099, 0x02008b58, 0x02004ec0,
+    0x02008336, 0x0200523a, 0x02005207, 0x02005ea6, 0x020062d3, 0x02007cd6,
+    0x02005b85, 0x02006d1e, 0x020066b4, 0x02008f3b, 0x0200884c, 0x0200964d,
+    0x0200898b, 0x02005ed3, 0x02005140, 0x020055c0, 0x0200585a, 0x02006674,
+    0x020051de, 0x0200732a, 0x020076ca, 0x0200793c, 0x0200795e, 0x02007965,
+    0x0200798f, 0x02009756, 0x02007cbe, 0x02007fbd, 0x02008612, 0x02008af8,
+    0x02009038, 0x020090fd, 0x020098ef, 0x020098fc, 0x02009928, 0x02009db4,
+    0x020090de, 0x020096b7, 0x02004fae, 0x020050e7, 0x0200514d, 0x020052c9,
+    0x020052e4, 0x02005351, 0x0200559d, 0x02005606, 0x02005668, 0x02005840,
+    0x020058a8, 0x02005c64, 0x02005c6e, 0x02006094, 0x02006168, 0x0200618e,
+    0x020061f2, 0x0200654f, 0x020065e2, 0x02006691, 0x02006885, 0x02006d77,
+    0x02006e1a, 0x02006f22, 0x0200716e, 0x0200722b, 0x02007422, 0x02007891,
+    0x0200793e, 0x02007949, 0x02007948, 0x02007950, 0x02007956, 0x0200795d,
+    0x0200798d, 0x0200798e, 0x02007a40, 0x02007a81, 0x02007bc0, 0x02007e09,
+    0x02007e41, 0x02007f72, 0x02008005, 0x020081ed, 0x02008279, 0x02008457,
+    0x02008910, 0x02008996, 0x02008b01, 0x02008b39, 0x02008cd3, 0x02008d08,
+    0x02008fb6, 0x020096e3, 0x020097ff, 0x0200983b, 0x02006075, 0x020242ee,
+    0x02008218, 0x02004e26, 0x020051b5, 0x02005168, 0x02004f80, 0x02005145,
+    0x02005180, 0x020052c7, 0x020052fa, 0x02005555, 0x02005599, 0x020055e2,
+    0x020058b3, 0x02005944, 0x02005954, 0x02005a62, 0x02005b28, 0x02005ed2,
+    0x02005ed9, 0x02005f69, 0x02005fad, 0x020060d8, 0x0200614e, 0x02006108,
+    0x02006160, 0x02006234, 0x020063c4, 0x0200641c, 0x02006452, 0x02006556,
+    0x0200671b, 0x02006756, 0x02006b79, 0x02006edb, 0x02006ecb, 0x0200701e,
+    0x020077a7, 0x02007235, 0x020072af, 0x02007471, 0x02007506, 0x0200753b,
+    0x0200761d, 0x0200761f, 0x020076db, 0x020076f4, 0x0200774a, 0x02007740,
+    0x020078cc, 0x02007ab1, 0x02007c7b, 0x02007d5b, 0x02007f3e, 0x02008352,
+    0x020083ef, 0x02008779, 0x02008941, 0x02008986, 0x02008abf, 0x02008acb,
+    0x02008aed, 0x02008b8a, 0x02008f38, 0x02009072, 0x02009199, 0x02009276,
+    0x0200967c, 0x020097db, 0x0200980b, 0x02009b12, 0x0202284a, 0x02022844,
+    0x020233d5, 0x02003b9d, 0x02004018, 0x02004039, 0x02025249, 0x02025cd0,
+    0x02027ed3, 0x02009f43, 0x02009f8e, 0x040005e2, 0x040005d4, 0x040005db,
+    0x040005dc, 0x040005dd, 0x040005e8, 0x040005ea, 0x04000671, 0x0400067b,
+    0x0400067e, 0x04000680, 0x0400067a, 0x0400067f, 0x04000679, 0x040006a4,
+    0x040006a6, 0x04000684, 0x04000683, 0x04000686, 0x04000687, 0x0400068d,
+    0x0400068c, 0x0400068e, 0x04000688, 0x04000698, 0x04000691, 0x040006a9,
+    0x040006af, 0x040006b3, 0x040006b1, 0x040006ba, 0x040006bb, 0x040006c0,
+    0x040006c1, 0x040006be, 0x040006d2, 0x040006d3, 0x040006ad, 0x040006c7,
+    0x040006c6, 0x040006c8, 0x040006cb, 0x040006c5, 0x040006c9, 0x040006d0,
+    0x04000649, 0x040006cc, 0x04000621, 0x04000622, 0x04000623, 0x04000624,
+    0x04000625, 0x04000626, 0x04000627, 0x04000628, 0x04000629, 0x0400062a,
+    0x0400062b, 0x0400062c, 0x0400062d, 0x0400062e, 0x0400062f, 0x04000630,
+    0x04000631, 0x04000632, 0x04000633, 0x04000634, 0x04000635, 0x04000636,
+    0x04000637, 0x04000638, 0x04000639, 0x0400063a, 0x04000641, 0x04000642,
+    0x04000643, 0x04000644, 0x04000645, 0x04000646, 0x04000647, 0x04000648,
+    0x0400064a, 0x040030f2, 0x040030a1, 0x040030a3, 0x040030a5, 0x040030a7,
+    0x040030a9, 0x040030e3, 0x040030e5, 0x040030e7, 0x040030c3, 0x040030fc,
+    0x040030a2, 0x040030a4, 0x040030a6, 0x040030a8, 0x040030aa, 0x040030ab,
+    0x040030ad, 0x040030af, 0x040030b1, 0x040030b3, 0x040030b5, 0x040030b7,
+    0x040030b9, 0x040030bb, 0x040030bd, 0x040030bf, 0x040030c1, 0x040030c4,
+    0x040030c6, 0x040030c8, 0x040030ca, 0x040030cb, 0x040030cc, 0x040030cd,
+    0x040030ce, 0x040030cf, 0x040030d2, 0x040030d5, 0x040030d8, 0x040030db,
+    0x040030de, 0x040030df, 0x040030e0, 0x040030e1, 0x040030e2, 0x040030e4,
+    0x040030e6, 0x040030e8, 0x040030e9, 0x040030ea, 0x040030eb, 0x040030ec,
+    0x040030ed, 0x040030ef, 0x040030f3, 0x04003099, 0x0400309a, 0x040002d0,
+    0x040002d1, 0x04000299, 0x04000253, 0x040002a3, 0x0400ab66, 0x040002a5,
+    0x040002a4, 0x04000256, 0x04000257, 0x04001d91, 0x04000258, 0x0400025e,
+    0x040002a9, 0x04000264, 0x04000262, 0x04000260, 0x0400029b, 0x0400029c,
+    0x04000267, 0x04000284, 0x040002aa, 0x040002ab, 0x0400026c, 0x0401df04,
+    0x0400a78e, 0x0400026e, 0x0401df05, 0x0400028e, 0x0401df06, 0x040000f8,
+    0x04000276, 0x04000277, 0x0400027a, 0x0401df08, 0x0400027d, 0x0400027e,
+    0x04000280, 0x040002a8, 0x040002a6, 0x0400ab67, 0x040002a7, 0x04000288,
+    0x04002c71, 0x0400028f, 0x040002a1, 0x040002a2, 0x04000298, 0x040001c0,
+    0x040001c1, 0x040001c2, 0x0401df0a, 0x0401df1e, 0x04000237, 0x040003bb,
+    0x040003be, 0x040003c8, 0x040003c9, 0x040003b5, 0x040003b6, 0x040003b7,
+    0x040003bc, 0x040003c4, 0x040003dd, 0x0400066e, 0x040006a1, 0x0400066f,
+    0x02004e3d, 0x02004e38, 0x02004e41, 0x02020122, 0x02004f60, 0x02004fbb,
+    0x02005002, 0x0200507a, 0x02005099, 0x020050cf, 0x0200349e, 0x0202063a,
+    0x02005154, 0x02005164, 0x02005177, 0x0202051c, 0x020034b9, 0x02005167,
+    0x0200518d, 0x0202054b, 0x02005197, 0x020051a4, 0x02004ecc, 0x020051ac,
+    0x020291df, 0x020051f5, 0x02005203, 0x020034df, 0x0200523b, 0x02005246,
+    0x02005272, 0x02005277, 0x02003515, 0x02005305, 0x02005306, 0x02005349,
+    0x0200535a, 0x02005373, 0x0200537d, 0x0200537f, 0x02020a2c, 0x02007070,
+    0x020053ca, 0x020053df, 0x02020b63, 0x020053eb, 0x020053f1, 0x02005406,
+    0x0200549e, 0x02005438, 0x02005448, 0x02005468, 0x020054a2, 0x020054f6,
+    0x02005510, 0x02005553, 0x02005563, 0x02005584, 0x020055ab, 0x020055b3,
+    0x020055c2, 0x02005716, 0x02005717, 0x02005651, 0x02005674, 0x020058ee,
+    0x020057ce, 0x020057f4, 0x0200580d, 0x0200578b, 0x02005832, 0x02005831,
+    0x020058ac, 0x020214e4, 0x020058f2, 0x020058f7, 0x02005906, 0x0200591a,
+    0x02005922, 0x02005962, 0x020216a8, 0x020216ea, 0x020059ec, 0x02005a1b,
+    0x02005a27, 0x020059d8, 0x02005a66, 0x020036ee, 0x020036fc, 0x02005b08,
+    0x02005b3e, 0x020219c8, 0x02005bc3, 0x02005bd8, 0x02005bf3, 0x02021b18,
+    0x02005bff, 0x02005c06, 0x02005f53, 0x02005c22, 0x02003781, 0x02005c60,
+    0x02005cc0, 0x02005c8d, 0x02021de4, 0x02005d43, 0x02021de6, 0x02005d6e,
+    0x02005d6b, 0x02005d7c, 0x02005de1, 0x02005de2, 0x0200382f, 0x02005dfd,
+    0x02005e28, 0x02005e3d, 0x02005e69, 0x02003862, 0x02022183, 0x0200387c,
+    0x02005eb0, 0x02005eb3, 0x02005eb6, 0x0202a392, 0x02005efe, 0x02022331,
+    0x02008201, 0x02005f22, 0x020038c7, 0x020232b8, 0x020261da, 0x02005f62,
+    0x02005f6b, 0x020038e3, 0x02005f9a, 0x02005fcd, 0x02005fd7, 0x02005ff9,
+    0x02006081, 0x0200393a, 0x0200391c, 0x020226d4, 0x020060c7, 0x02006148,
+    0x0200614c, 0x0200617a, 0x020061b2, 0x020061a4, 0x020061af, 0x020061de,
+    0x02006210, 0x0200621b, 0x0200625d, 0x020062b1, 0x020062d4, 0x02006350,
+    0x02022b0c, 0x0200633d, 0x020062fc, 0x02006368, 0x02006383, 0x020063e4,
+    0x02022bf1, 0x02006422, 0x020063c5, 0x020063a9, 0x02003a2e, 0x02006469,
+    0x0200647e, 0x0200649d, 0x02006477, 0x02003a6c, 0x0200656c, 0x0202300a,
+    0x020065e3, 0x020066f8, 0x02006649, 0x02003b19, 0x02003b08, 0x02003ae4,
+    0x02005192, 0x02005195, 0x02006700, 0x0200669c, 0x020080ad, 0x020043d9,
+    0x02006721, 0x0200675e, 0x02006753, 0x020233c3, 0x02003b49, 0x020067fa,
+    0x02006785, 0x02006852, 0x0202346d, 0x0200688e, 0x0200681f, 0x02006914,
+    0x02006942, 0x020069a3, 0x020069ea, 0x02006aa8, 0x020236a3, 0x02006adb,
+    0x02003c18, 0x02006b21, 0x020238a7, 0x02006b54, 0x02003c4e, 0x02006b72,
+    0x02006b9f, 0x02006bbb, 0x02023a8d, 0x02021d0b, 0x02023afa, 0x02006c4e,
+    0x02023cbc, 0x02006cbf, 0x02006ccd, 0x02006c67, 0x02006d16, 0x02006d3e,
+    0x02006d69, 0x02006d78, 0x02006d85, 0x02023d1e, 0x02006d34, 0x02006e2f,
+    0x02006e6e, 0x02003d33, 0x02006ec7, 0x02023ed1, 0x02006df9, 0x02006f6e,
+    0x02023f5e, 0x02023f8e, 0x02006fc6, 0x02007039, 0x0200701b, 0x02003d96,
+    0x0200704a, 0x0200707d, 0x02007077, 0x020070ad, 0x02020525, 0x02007145,
+    0x02024263, 0x0200719c, 0x020243ab, 0x02007228, 0x02007250, 0x02024608,
+    0x02007280, 0x02007295, 0x02024735, 0x02024814, 0x0200737a, 0x0200738b,
+    0x02003eac, 0x020073a5, 0x02003eb8, 0x02007447, 0x0200745c, 0x02007485,
+    0x020074ca, 0x02003f1b, 0x02007524, 0x02024c36, 0x0200753e, 0x02024c92,
+    0x0202219f, 0x02007610, 0x02024fa1, 0x02024fb8, 0x02025044, 0x02003ffc,
+    0x02004008, 0x020250f3, 0x020250f2, 0x02025119, 0x02025133, 0x0200771e,
+    0x0200771f, 0x0200778b, 0x02004046, 0x02004096, 0x0202541d, 0x0200784e,
+    0x020040e3, 0x02025626, 0x0202569a, 0x020256c5, 0x020079eb, 0x0200412f,
+    0x02007a4a, 0x02007a4f, 0x0202597c, 0x02025aa7, 0x02007aee, 0x02004202,
+    0x02025bab, 0x02007bc6, 0x02007bc9, 0x02004227, 0x02025c80, 0x02007cd2,
+    0x020042a0, 0x02007ce8, 0x02007ce3, 0x02007d00, 0x02025f86, 0x02007d63,
+    0x02004301, 0x02007dc7, 0x02007e02, 0x02007e45, 0x02004334, 0x02026228,
+    0x02026247, 0x02004359, 0x020262d9, 0x02007f7a, 0x0202633e, 0x02007f95,
+    0x02007ffa, 0x020264da, 0x02026523, 0x02008060, 0x020265a8, 0x02008070,
+    0x0202335f, 0x020043d5, 0x020080b2, 0x02008103, 0x0200440b, 0x0200813e,
+    0x02005ab5, 0x020267a7, 0x020267b5, 0x02023393, 0x0202339c, 0x02008204,
+    0x02008f9e, 0x0200446b, 0x02008291, 0x0200828b, 0x0200829d, 0x020052b3,
+    0x020082b1, 0x020082b3, 0x020082bd, 0x020082e6, 0x02026b3c, 0x0200831d,
+    0x02008363, 0x020083ad, 0x02008323, 0x020083bd, 0x020083e7, 0x02008353,
+    0x020083ca, 0x020083cc, 0x020083dc, 0x02026c36, 0x02026d6b, 0x02026cd5,
+    0x0200452b, 0x020084f1, 0x020084f3, 0x02008516, 0x020273ca, 0x02008564,
+    0x02026f2c, 0x0200455d, 0x02004561, 0x02026fb1, 0x020270d2, 0x0200456b,
+    0x02008650, 0x02008667, 0x02008669, 0x020086a9, 0x02008688, 0x0200870e,
+    0x020086e2, 0x02008728, 0x0200876b, 0x02008786, 0x020045d7, 0x020087e1,
+    0x02008801, 0x020045f9, 0x02008860, 0x02008863, 0x02027667, 0x020088d7,
+    0x020088de, 0x02004635, 0x020088fa, 0x020034bb, 0x020278ae, 0x02027966,
+    0x020046be, 0x020046c7, 0x02008aa0, 0x02008c55, 0x02027ca8, 0x02008cab,
+    0x02008cc1, 0x02008d1b, 0x02008d77, 0x02027f2f, 0x02020804, 0x02008dcb,
+    0x02008dbc, 0x02008df0, 0x020208de, 0x02008ed4, 0x020285d2, 0x020285ed,
+    0x02009094, 0x020090f1, 0x02009111, 0x0202872e, 0x0200911b, 0x02009238,
+    0x020092d7, 0x020092d8, 0x0200927c, 0x020093f9, 0x02009415, 0x02028bfa,
+    0x0200958b, 0x02004995, 0x020095b7, 0x02028d77, 0x020049e6, 0x020096c3,
+    0x02005db2, 0x02009723, 0x02029145, 0x0202921a, 0x02004a6e, 0x02004a76,
+    0x020097e0, 0x0202940a, 0x02004ab2, 0x02029496, 0x02009829, 0x020295b6,
+    0x020098e2, 0x02004b33, 0x02009929, 0x020099a7, 0x020099c2, 0x020099fe,
+    0x02004bce, 0x02029b30, 0x02009c40, 0x02009cfd, 0x02004cce, 0x02004ced,
+    0x02009d67, 0x0202a0ce, 0x02004cf8, 0x0202a105, 0x0202a20e, 0x0202a291,
+    0x02009ebb, 0x02004d56, 0x02009ef9, 0x02009efe, 0x02009f05, 0x02009f0f,
+    0x02009f16, 0x02009f3b, 0x0202a600,
+};
+
+#endif
@@ -0,0 +1,221 @@
+#!/usr/bin/env python3
+# Generates utf8tab.h, the word class, case folding and normalization tables
+# of utf8.c, from the Unicode character database of Python's unicodedata.
+# 'make utf8tab' runs it: python3 utf8tab.py > utf8tab.h
+
+import unicodedata
+
+# The combining diacritical marks, removed by diacritics
+DIACRITICS = [(0x300, 0x36F), (0x1AB0, 0x1AFF), (0x1DC0, 0x1DFF),
+              (0x20D0, 0x20FF), (0xFE20, 0xFE2F)]
+
+# The Default_Ignorable_Code_Point characters, removed by ignorables
+IGNORABLES = [(0xAD, 0xAD), (0x34F, 0x34F), (0x61C, 0x61C), (0x115F, 0x1160),
+              (0x17B4, 0x17B5), (0x180B, 0x180F), (0x200B, 0x200F),
+              (0x202A, 0x202E), (0x2060, 0x206F), (0x3164, 0x3164),
+              (0xFE00, 0xFE0F), (0xFEFF, 0xFEFF), (0xFFA0, 0xFFA0),
+              (0xFFF0, 0xFFF8), (0x1BCA0, 0x1BCA3), (0x1D173, 0x1D17A),
+              (0xE0000, 0xE0FFF)]
+
+# The letters with a stroke, which have no canonical decomposition
+STROKES = dict(zip("øłđħŧƀɨƶǥɇȼ", "oldhtbizgec"))
+
+# The Cyrillic and Greek letters that look like a Latin letter
+HOMOGLYPHS = [("АВЕКМНОРСТХЅІЈҮӀ", "ABEKMHOPCTXSIJYI"),
+              ("аеорсухѕіјһԁԛԝӏ", "aeopcyxsijhdqwl"),
+              ("ΑΒΕΖΗΙΚΜΝΟΡΤΥΧ", "ABEZHIKMNOPTYX"),
+              ("ονιακρυ", "oviakpu"),
+              ("ıɩɑɡ", "iiag")]
+
+# The NORM_ flags of norm.h
+NORM_DIACRITICS = 2
+NORM_CONFUSABLES = 4
+NORM_IGNORABLES = 8
+
+
+def within(c, ranges):
+    return any(a <= c <= b for a, b in ranges)
+
+
+def is_word(c):
+    return unicodedata.category(chr(c))[0] in "LMN"
+
+
+def is_surrogate(c):
+    return 0xD800 <= c < 0xE000
+
+
+# The simple case folding of c, or its lower case where that has none
+def fold(c):
+    f = chr(c).casefold()
+    if len(f) == 1:
+        return ord(f)
+    low = chr(c).lower()
+    return ord(low) if len(low) == 1 else c
+
+
+# What c becomes with diacritics, or None
+def diacritic(c):
+    if within(c, DIACRITICS):
+        return 0
+    f = chr(fold(c))
+    if f in STROKES:
+        return ord(STROKES[f])
+    s = "".join(x for x in unicodedata.normalize("NFD", f)
+                if not within(ord(x), DIACRITICS))
+    if len(s) == 1 and s != f:
+        return fold(ord(s))
+    return None
+
+
+# What c becomes with confusables, or None
+def confusable(c, homoglyphs):
+    if unicodedata.decomposition(chr(c)).startswith("<"):
+        t = unicodedata.normalize("NFKC", chr(c))
+        if len(t) == 1 and is_word(ord(t)):
+            t = ord(t)
+            return fold(homoglyphs.get(t, t))
+    if c in homoglyphs:
+        return fold(homoglyphs[c])
+    return None
+
+
+# Splits values into blocks of size values, and returns the distinct blocks
+# (a dict from each to its number) and the number of each block in turn
+def blocks(values, size):
+    found = {}
+    index = []
+    for b in range(0, len(values), size):
+        t = tuple(values[b:b + size])
+        if t not in found:
+            found[t] = len(found)
+        index.append(found[t])
+    return found, index
+
+
+def flatten(found):
+    return [x for t in sorted(found, key=found.get) for x in t]
+
+
+def array(name, ctype, items):
+    out = [f"static const {ctype} {name}[{len(items)}] = {{"]
+    line = "   "
+    for x in items:
+        s = f" {x},"
+        if len(line) + len(s) > 80:
+            out.append(line)
+            line = "   "
+        line += s
+    out.append(line)
+    out.append("};")
+    return "\n".join(out)
+
+
+def main():
+    homoglyphs = {}
+    for src, dst in HOMOGLYPHS:
+        assert len(src) == len(dst), src
+        for a, b in zip(src, dst):
+            homoglyphs[ord(a)] = ord(b)
+
+    # The class of each code point: 0, or 1 + the index of its fold delta
+    deltas = {0: 0}
+    classes = []
+    for c in range(0x110000):
+        if is_surrogate(c) or not is_word(c):
+            classes.append(0)
+            continue
+        d = fold(c) - c
+        if d not in deltas:
+            deltas[d] = len(deltas)
+        classes.append(1 + deltas[d])
+    leaves, leaf_index = blocks(classes, 8)
+    mids, mid_index = blocks(leaf_index, 32)
+    assert len(leaves) < 256 and len(mids) < 256 and len(deltas) < 255
+
+    # The normalization of each code point: the index of its entry
+    entries = {(0, 0): 0}
+    norms = []
+    for c in range(0x110000):
+        e = None
+        if is_surrogate(c):
+            pass
+        elif within(c, IGNORABLES):
+            e = (0, NORM_IGNORABLES)
+        elif is_word(c):
+            t = diacritic(c)
+            if t is not None:
+                e = (t, NORM_DIACRITICS)
+            else:
+                t = confusable(c, homoglyphs)
+                if t is not None and t != fold(c):
+                    e = (t, NORM_CONFUSABLES)
+        if e is None:
+            norms.append(0)
+            continue
+        if e not in entries:
+            entries[e] = len(entries)
+        norms.append(entries[e])
+    norm_leaves, norm_leaf_index = blocks(norms, 16)
+    norm_mids, norm_mid_index = blocks(norm_leaf_index, 32)
+    assert len(norm_mids) < 256 and len(norm_leaves) < 65536
+
+    print(f"""#ifndef __UTF8TAB_H__
+#define __UTF8TAB_H__
+
+#include <stdint.h>
+
+// Generated by utf8tab.py ('make utf8tab') from the Unicode
+// {unicodedata.unidata_version} character database. Do not edit.
+// The class of a code point c is
+//   utf8_leaves[8 * utf8_mids[32 * utf8_index[c >> 8] + ((c >> 3) & 31)] +
+//               (c & 7)]
+// which is 0 if c can't be part of a word, or else 1 + the index in
+// utf8_deltas of what to add to c to case fold it. Word characters are the
+// letters, marks and numbers (general categories L*, M* and N*). The folding
+// is the simple case folding (one code point to one code point), or the lower
+// case mapping where that has none.
+#define UTF8_BLOCKS {len(mid_index)}
+
+{array("utf8_index", "uint8_t", mid_index)}
+
+{array("utf8_mids", "uint8_t", flatten(mids))}
+
+{array("utf8_leaves", "uint8_t", flatten(leaves))}
+
+{array("utf8_deltas", "int32_t", sorted(deltas, key=deltas.get))}
+
+// The normalization of a code point c is found like its class, in blocks of
+// 16 code points:
+//   utf8_norms[utf8_norm_leaves[16 * utf8_norm_mids[32 * m + ((c >> 4) & 31)] +
+//                               (c & 15)]]
+// where m = utf8_norm_index[c >> 9]. The low 24 bits of an entry of utf8_norms
+// are the code point c becomes (case folded), or 0 if it is removed, and the
+// high 8 bits are the kind of normalization (a NORM_ flag of norm.h); 0 means
+// c isn't normalized. Only one kind applies to a code point, in this order:
+// - ignorables: the Default_Ignorable_Code_Point characters (zero width
+//   spaces and joiners, soft hyphens, variation selectors...), removed.
+// - diacritics: the combining diacritical marks, removed, and the letters
+//   whose canonical decomposition is a letter and such marks (or that are a
+//   letter with a stroke, like ł or ø), which become that letter.
+// - confusables: the letters and numbers with a compatibility decomposition
+//   to one letter or number (fullwidth and mathematical letters,
+//   superscripts...), and the Cyrillic and Greek letters that look like a
+//   Latin letter, which become that Latin letter.
+// The result may be normalized again (ё becomes е, which becomes e).
+#define UTF8_NORM_BLOCKS {len(norm_mid_index)}
+
+{array("utf8_norm_index", "uint8_t", norm_mid_index)}
+
+{array("utf8_norm_mids", "uint16_t", flatten(norm_mids))}
+
+{array("utf8_norm_leaves", "uint16_t", flatten(norm_leaves))}
+
+{array("utf8_norms", "uint32_t",
+       [f"0x{t | k << 24:08x}" for t, k in sorted(entries, key=entries.get)])}
+
+#endif""")
+
+
+if __name__ == "__main__":
+    main()